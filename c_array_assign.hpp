@@ -9,7 +9,8 @@
   c_array_assign.hpp
   ==================
 
-  Requires C++20 and depends on <concepts> and "c_array_support.hpp".
+  Requires C++20 and depends on <concepts>, <cstring> (for memmove),
+  <initializer_list>, <limits>, <utility> and "c_array_support.hpp".
 
   This header defines 'assign(l)', generic assignment function, and its
   customization point 'assign_to', with C array specialization, plus a
@@ -18,6 +19,10 @@
    * assign(l) = r; a uniform assignment syntax for lvalue variables
    * assign_to<T[N]> an assignable reference-wrapper for array variables
    * assign_elements(l,e...) assigns elements directly by move or copy
+   * fill(l,v), or assign(l).fill(v), assigns v to every element of l
+   * assign_block<Ext...>(l,at,r,from) assigns a sub-block, or tile
+   * assign_transposed(l,r) assigns the transpose of 2D array r to l
+   * swap_arrays(a,b) swaps the elements of arrays a and b
 
   Traits and concepts for assign() are defined as versions of std traits
   that check element type e = lml::all_extents_removed<T> instead of T:
@@ -31,6 +36,11 @@
    * lml::assignable_from<L,R> = std::assignable_from<eL,eR>
                                       && same_extents<L,R>
 
+  A trait detects element types for which value-initialization, v = {},
+  gives all-zero bits, to clear arrays by memset; specialize it to opt-in:
+
+   * lml::is_value_init_zero_bits_v<T>
+
   New concepts are introduced for empty brace init and assignment: qq
 
    * lml::empty_list_initializable<T> true if T v{} is well-formed
@@ -64,6 +74,12 @@
     lml::assign(l) = {}
     lml::assign(l) = {1,2}
     lml::assign_elements(l,4,2)
+    lml::fill(l,7)
+    lml::assign(l).fill(7)
+    lml::assign_block<8,8>(tile, image, r, c)
+    lml::assign_block<2,8,8>(l, {i,j,k}, r, {0,r,c})
+    lml::assign_transposed(l,r)
+    lml::swap_arrays(l,r)
 
   An lvalue reference to l is returned, as for regular assignment l = r.
 
@@ -83,14 +99,67 @@
 
   Performance
   ===========
-  Copy optimizations such as memcpy specializations are not done, yet.
-  Nested array copies have both constexpr and runtime implementations.
+  Array copies of unpadded arrays of the same trivially assignable,
+  non-volatile element type are done by a single memmove at runtime
+  (memmove, not memcpy, as the source may alias the target; an lvalue
+  source of the same type may be the target itself). Arrays of at most
+  64 bytes are copied by straight-line fixed-width loads then stores.
+  Converting copies between unpadded arrays of different arithmetic
+  element types, e.g. float[M][N] = double[M][N], run a restrict-pointer
+  loop in blocks of 16 that compilers vectorize as widening, narrowing
+  or int/float vector conversions (if source and target don't overlap).
+  Other array copies, and all copies in constant evaluation, loop over
+  elements by flat_index; backward, at runtime, if the target overlaps
+  the source from above, e.g. to shift a window within one array by
+  assign between flat_cast views, so that copies are overlap-safe
+  (for the same element size, as memmove).
+  Array clears, assign(l) = {}, are done by a single memset at runtime
+  for unpadded arrays of is_value_init_zero_bits_v trivially copyable
+  element type; compilers expand a small fixed-size memset into vector
+  stores.
+
+  Streaming
+  =========
+    lml::assign(l, lml::nontemporal) = r
+    lml::assign(l, lml::nontemporal) = {}
+
+  An opt-in for large copies and clears that won't be read again soon;
+  the target is written with SSE2 non-temporal stores, that bypass the
+  cache so don't evict the working set, followed by a store fence.
+  Only for arrays that are memmove copyable or memset clearable, as above.
+  (Without SSE2, or if source and target overlap, memmove or memset.)
+
+  Saturation
+  ==========
+    lml::assign_saturate(l) = r
+    lml::saturate_cast<T>(v)   c.f. C++26 std::saturate_cast
+
+  Narrowing integer array conversion that clamps out-of-range values to
+  the target's range, e.g. unsigned char[N] = int[N] with 300 -> 255 and
+  -1 -> 0, vectorized as for converting copies (to min/max and packs).
 */
 
 #include <concepts>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <utility>
 
 #include "c_array_support.hpp"
 
+#ifndef __UINTPTR_TYPE__
+#include <cstdint>
+#  define UINTPTR uintptr_t
+#else
+#  define UINTPTR __UINTPTR_TYPE__
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) \
+ || (defined(_M_IX86_FP) && _M_IX86_FP == 2)
+#include <emmintrin.h>
+#  define SIMD_SSE2
+#endif
+
 #include "namespace.hpp"
 
 // Detect language support for array copy semantics as proposed in P1997
@@ -213,6 +282,26 @@ inline constexpr bool is_nothrow_move_assignable_v = (is_copyable_array
 template <typename T> using is_nothrow_move_assignable
        = std::bool_constant<is_nothrow_move_assignable_v<T>>;
 
+// is_value_init_zero_bits_v<T> true if a value-initialized T, T{}, has
+//   an object representation of all-zero bits; true for integral, enum,
+//   pointer, nullptr_t and IEEE floating point types (not for pointer to
+//   data member, usually -1), false else; true for arrays of such types.
+// Specialize for class types for which it is known to hold, as an opt-in
+// to the memset path of assign(l) = {} for arrays of the class type.
+//
+template <typename T>
+inline constexpr bool is_value_init_zero_bits_v
+               = ! std::is_volatile_v<T>
+              && (std::is_integral_v<T> || std::is_enum_v<T>
+               || std::is_pointer_v<T> || std::is_null_pointer_v<T>
+               || (std::is_floating_point_v<T>
+                && std::numeric_limits<T>::is_iec559));
+template <c_array T>
+inline constexpr bool is_value_init_zero_bits_v<T>
+               = is_value_init_zero_bits_v<remove_all_extents_t<T>>;
+template <typename T> using is_value_init_zero_bits
+       = std::bool_constant<is_value_init_zero_bits_v<T>>;
+
 // empty_list_initializable<T> concept
 //  true if T can be copy initialized from empty list; T v = {};
 //   i.e. T has a default constructor, not explicit (or deleted?)
@@ -243,6 +332,176 @@ template <typename T>
 using is_nothrow_empty_list_assignable = std::bool_constant<
          noexcept(std::declval<all_extents_removed_t<T>&>() = {})>;
 
+namespace impl {
+
+// memmove_assignable_from<L,R>
+//   A helper concept for the memmove specializations of array copy; true
+//   for same-shape unpadded arrays of the same non-volatile element type
+//   for which assignment from R's element is trivial, i.e. a bit copy
+//
+template <typename L, typename R,
+          typename E = remove_all_extents_t<std::remove_reference_t<L>>>
+concept memmove_assignable_from =
+     c_array_unpadded<L> && c_array_unpadded<R>
+  && same_extents<std::remove_cvref_t<L>,std::remove_cvref_t<R>>
+  && std::is_same_v<E, std::remove_cv_t<
+                    remove_all_extents_t<std::remove_reference_t<R>>>>
+  && ! std::is_volatile_v<E>
+  && ! std::is_volatile_v<remove_all_extents_t<std::remove_reference_t<R>>>
+  && std::is_trivially_assignable_v<E&, all_extents_removed_t<R&&>>;
+
+// memset_clearable<L>
+//   A helper concept for the memset specialization of array clear, = {};
+//   true for unpadded arrays of trivially copyable element type that is
+//   value-initialized as all-zero bits
+//
+template <typename L, typename E = remove_all_extents_t<
+                                   std::remove_reference_t<L>>>
+concept memset_clearable =
+     c_array_unpadded<L>
+  && ! std::is_const_v<E>
+  && std::is_trivially_copyable_v<E>
+  && is_value_init_zero_bits_v<E>;
+
+// convert_assignable_from<L,R>
+//   A helper concept for the vectorizable converting copy; true for
+//   same-shape unpadded arrays of different, non-volatile, arithmetic
+//   element types
+//
+template <typename L, typename R,
+          typename E = remove_all_extents_t<std::remove_reference_t<L>>,
+          typename F = remove_all_extents_t<std::remove_reference_t<R>>>
+concept convert_assignable_from =
+     c_array_unpadded<L> && c_array_unpadded<R>
+  && same_extents<std::remove_cvref_t<L>,std::remove_cvref_t<R>>
+  && std::is_arithmetic_v<E> && std::is_arithmetic_v<F>
+  && ! std::is_same_v<E, std::remove_cv_t<F>>
+  && ! std::is_const_v<E>
+  && ! std::is_volatile_v<E> && ! std::is_volatile_v<F>;
+
+// disjoint(l,r) true if the objects l and r don't overlap in memory
+//
+template <typename L, typename R>
+inline bool disjoint(L const& l, R const& r) noexcept
+{
+  auto lp = reinterpret_cast<UINTPTR>(&l), rp = reinterpret_cast<UINTPTR>(&r);
+  return lp + sizeof l <= rp || rp + sizeof r <= lp;
+}
+
+// overlaps_ahead(l,r) true if object l starts inside object r, after its
+//   start, so that a forward element-wise copy from r to l would overwrite
+//   elements of r before they are read; the copy must run backward
+//
+template <typename L, typename R>
+inline bool overlaps_ahead(L const& l, R const& r) noexcept
+{
+  auto lp = reinterpret_cast<UINTPTR>(&l), rp = reinterpret_cast<UINTPTR>(&r);
+  return rp < lp && lp < rp + sizeof r;
+}
+
+// convert_n<N>(d,s,cvt) assigns d[i] = cvt(s[i]) for the N elements at s,
+//   in blocks of 16 independent elements then a tail, for non-aliased
+//   d and s; an idiom that compilers vectorize for conversions cvt
+//
+template <std::size_t N, typename D, typename S, typename C>
+inline void convert_n(D* __restrict d, S const* __restrict s, C cvt)
+  noexcept
+{
+  constexpr std::size_t B = N - N % 16;
+  for (std::size_t i = 0; i != B; i += 16)
+    for (int j = 0; j != 16; ++j)
+      d[i + j] = cvt(s[i + j]);
+  for (std::size_t j = 0; j != N % 16; ++j)
+    d[B + j] = cvt(s[B + j]);
+}
+
+inline constexpr std::size_t small_copy_bytes = 64;
+
+template <std::size_t W>
+struct word_bytes { unsigned char b[W]; };
+
+// small_copy<S>(d,s) copies the S <= 64 bytes at s to d by a straight-line
+//   sequence of fixed-width word loads, 16, 8, 4, 2 or 1 bytes, the last
+//   overlapping the previous for odd sizes, then stores; no call, no loop.
+// All loads precede all stores, so it's safe for overlapping d and s.
+//
+template <std::size_t S>
+inline void small_copy(void* dp, void const* sp) noexcept
+{
+  static_assert(S <= small_copy_bytes);
+  auto d = static_cast<unsigned char*>(dp);
+  auto s = static_cast<unsigned char const*>(sp);
+  constexpr std::size_t W = S >= 16 ? 16 : S >= 8 ? 8 : S >= 4 ? 4
+                          : S >= 2 ? 2 : 1;
+  constexpr std::size_t K = S == 0 ? 0 : (S + W - 1) / W;
+  [=]<std::size_t... k>(std::index_sequence<k...>) {
+    constexpr std::size_t at[K ? K : 1]{(k + 1 == K ? S - W : k*W)...};
+    word_bytes<W> w[K ? K : 1];
+    ((std::memcpy(&w[k], s + at[k], W)), ...);
+    ((std::memcpy(d + at[k], &w[k], W)), ...);
+  }(std::make_index_sequence<K>{});
+}
+
+// empty_list, an initializer_list<empty_list> parameter matches only an
+//   empty braced-init list, {}, and is preferred over an array parameter
+//   (a non-empty list fails to convert, as empty_list has no default ctor)
+//
+struct empty_list { empty_list(empty_list const&) = delete; };
+
+// fill_memsettable<A> true for arrays that fill(a,v) may fill by memset, or by
+//   broadcast stores of a copy of the first element, once assigned v
+//
+template <typename A, typename E = remove_all_extents_t<
+                                   std::remove_reference_t<A>>>
+concept fill_memsettable =
+     c_array_unpadded<A>
+  && ! std::is_volatile_v<E>
+  && std::is_trivially_copyable_v<E>
+  && std::is_trivially_copy_constructible_v<E>
+  && std::is_trivially_copy_assignable_v<E>;
+
+// fill(a,v) assigns v to each element of array a, of any rank.
+// At runtime, for fill_memsettable arrays of scalar element type, or for
+// v of the element type (so assignment is a plain copy that can't depend
+// on the old value), v is assigned to the first element only, then, if
+// its bytes are all equal, e.g. 0, -1 or a char, a memset fills the
+// rest, else a loop of stores of the copied element (a register
+// broadcast once vectorized). Other v are assigned to each element.
+//
+template <typename A, typename V>
+constexpr void fill(A& a, V const& v)
+  noexcept(noexcept(flat_index(a) = v))
+{
+  using E = remove_all_extents_t<A>;
+  if constexpr (flat_size<A> != 0 && fill_memsettable<A&>
+             && (std::is_scalar_v<E> || std::is_same_v<V, E>))
+  {
+    if (! std::is_constant_evaluated())
+    {
+      E* d = flat_cast(a);
+      d[0] = v;
+      unsigned char b[sizeof(E)];
+      std::memcpy(b, d, sizeof(E));
+      bool splat = true;
+      for (auto c : b)
+        splat &= c == b[0];
+      if (splat)
+        std::memset(d + 1, b[0], sizeof a - sizeof(E));
+      else
+      {
+        E const e = d[0];
+        for (std::size_t i = 1; i != flat_size<A>; ++i)
+          d[i] = e;
+      }
+      return;
+    }
+  }
+  for (int i = 0; i != flat_size<A>; ++i)
+    flat_index(a, i) = v;
+}
+
+} // impl
+
 // assign_to customization point to specialize as a reference-wrapper
 //                                  with operator= overloads
 // invoked by assign() function for types with assign_to specialization
@@ -266,10 +525,18 @@ struct assign_to<L>
 
   // operator=({}) overload for emtpy braced-init
   //
-  constexpr L& operator=(std::true_type) const
+  constexpr L& operator=(std::initializer_list<impl::empty_list>) const
       noexcept(noexcept(flat_index(l) = {}))
     requires empty_list_assignable<L&>
   {
+      if constexpr (impl::memset_clearable<L&>)
+      {
+          if (! std::is_constant_evaluated())
+          {
+              std::memset(&l, 0, sizeof l);
+              return l;
+          }
+      }
       for (int i = 0; i != flat_size<L>; ++i)
           flat_index(l, i) = {};
       return l;
@@ -282,16 +549,71 @@ struct assign_to<L>
   constexpr L& operator=(R&& r) const
       noexcept(noexcept(flat_index(l) = flat_index((R&&)r)))
   {
+      if constexpr (impl::memmove_assignable_from<L&, R&&>)
+      {
+          if (! std::is_constant_evaluated())
+          {
+              if constexpr (sizeof l <= impl::small_copy_bytes)
+                  impl::small_copy<sizeof l>(&l, &r);
+              else
+                  std::memmove(&l, &r, sizeof l);
+              return l;
+          }
+      }
+      else if constexpr (impl::convert_assignable_from<L&, R&&>)
+      {
+          if (! std::is_constant_evaluated() && impl::disjoint(l, r))
+          {
+              using E = remove_all_extents_t<value_type>;
+              impl::convert_n<flat_size<L>>(flat_cast(l), flat_cast(r),
+                                   [](auto v) { return static_cast<E>(v); });
+              return l;
+          }
+      }
+      if (! std::is_constant_evaluated() && impl::overlaps_ahead(l, r))
+      {
+          for (int i = flat_size<L>; i-- != 0; )
+              flat_index(l, i) = flat_index((R&&)r, i);
+          return l;
+      }
       for (int i = 0; i != flat_size<L>; ++i)
           flat_index(l, i) = flat_index((R&&)r, i);
       return l;
   }
 
+  // fill(v) assigns v to every element, lml::fill(l,v)
+  //
+  template <typename V>
+    requires std::is_assignable_v<all_extents_removed_t<L&>, V const&>
+  constexpr L& fill(V const& v) const
+      noexcept(noexcept(flat_index(l) = v))
+  {
+      impl::fill(l, v);
+      return l;
+  }
+
   // operator=(rval) overload for array rvalue from braced-init
   //
   constexpr L& operator=(value_type const& r) const
       noexcept(noexcept(flat_index(l) = flat_index(r)))
   {
+      if constexpr (impl::memmove_assignable_from<L&, value_type const&>)
+      {
+          if (! std::is_constant_evaluated())
+          {
+              if constexpr (sizeof l <= impl::small_copy_bytes)
+                  impl::small_copy<sizeof l>(&l, &r);
+              else
+                  std::memmove(&l, &r, sizeof l);
+              return l;
+          }
+      }
+      if (! std::is_constant_evaluated() && impl::overlaps_ahead(l, r))
+      {
+          for (int i = flat_size<L>; i-- != 0; )
+              flat_index(l, i) = flat_index(r, i);
+          return l;
+      }
       for (int i = 0; i != flat_size<L>; ++i)
           flat_index(l, i) = flat_index(r, i);
       return l;
@@ -309,6 +631,498 @@ constexpr decltype(auto) assign(L&& l) noexcept
         return (L&&)l;
 }
 
+// nontemporal_t tag type, and nontemporal tag value, to select streaming
+//   assignment, assign(l, nontemporal) = r, that bypasses the cache
+//
+struct nontemporal_t { explicit nontemporal_t() = default; };
+inline constexpr nontemporal_t nontemporal{};
+
+namespace impl {
+
+// stream_store(d,s,n) copies n bytes from s to d, or zeroes the n bytes
+//   at d if s is null, with non-temporal stores to the 16-byte aligned
+//   span of d, 64 bytes (a cache line) per iteration, then a store fence
+//
+inline void stream_store(void* dp, void const* sp, std::size_t n) noexcept
+{
+  auto d = static_cast<unsigned char*>(dp);
+  auto s = static_cast<unsigned char const*>(sp);
+  auto da = reinterpret_cast<UINTPTR>(d), sa = reinterpret_cast<UINTPTR>(s);
+  if (s && da < sa + n && sa < da + n) // overlap
+  {
+    std::memmove(d, s, n);
+    return;
+  }
+#ifdef SIMD_SSE2
+  std::size_t head = (16 - (da & 15)) & 15;
+  if (n < head + 16)
+    head = n;
+  auto b = d + head, e = b + ((n - head) & ~std::size_t{15});
+  if (s) std::memmove(d, s, head); else std::memset(d, 0, head);
+  auto v = reinterpret_cast<__m128i*>(b);
+  auto const ve = reinterpret_cast<__m128i*>(e);
+  if (s)
+  {
+    auto u = reinterpret_cast<__m128i const*>(s + head);
+    for (; ve - v >= 4; v += 4, u += 4)
+    {
+      __m128i x0 = _mm_loadu_si128(u),     x1 = _mm_loadu_si128(u + 1),
+              x2 = _mm_loadu_si128(u + 2), x3 = _mm_loadu_si128(u + 3);
+      _mm_stream_si128(v, x0);     _mm_stream_si128(v + 1, x1);
+      _mm_stream_si128(v + 2, x2); _mm_stream_si128(v + 3, x3);
+    }
+    for (; v != ve; ++v, ++u)
+      _mm_stream_si128(v, _mm_loadu_si128(u));
+    std::memmove(e, s + (e - d), n - static_cast<std::size_t>(e - d));
+  }
+  else
+  {
+    __m128i const z = _mm_setzero_si128();
+    for (; ve - v >= 4; v += 4)
+    {
+      _mm_stream_si128(v, z);     _mm_stream_si128(v + 1, z);
+      _mm_stream_si128(v + 2, z); _mm_stream_si128(v + 3, z);
+    }
+    for (; v != ve; ++v)
+      _mm_stream_si128(v, z);
+    std::memset(e, 0, n - static_cast<std::size_t>(e - d));
+  }
+  _mm_sfence();
+#else
+  if (s) std::memmove(d, s, n); else std::memset(d, 0, n);
+#endif
+}
+
+} // impl
+
+// assign_nontemporal<c_array> reference-wrapper returned by
+//   assign(l, nontemporal) for streaming array copy and clear.
+// Constant evaluation does regular assignment.
+//
+template <c_array L>
+struct assign_nontemporal
+{
+  L& l;
+
+  using value_type = std::remove_reference_t<L>;
+
+  // operator=({}) overload for emtpy braced-init
+  //
+  constexpr L& operator=(std::initializer_list<impl::empty_list>) const
+      noexcept
+    requires impl::memset_clearable<L&>
+  {
+      if (std::is_constant_evaluated())
+          return assign(l) = {};
+      impl::stream_store(&l, nullptr, sizeof l);
+      return l;
+  }
+
+  // operator=(lval) overload for array lvalues (and rvalue variables)
+  //
+  template <c_array R>
+    requires impl::memmove_assignable_from<L&, R&&>
+  constexpr L& operator=(R&& r) const noexcept
+  {
+      if (std::is_constant_evaluated())
+          return assign(l) = (R&&)r;
+      impl::stream_store(&l, &r, sizeof l);
+      return l;
+  }
+
+  // operator=(rval) overload for array rvalue from braced-init
+  //
+  constexpr L& operator=(value_type const& r) const noexcept
+    requires impl::memmove_assignable_from<L&, value_type const&>
+  {
+      if (std::is_constant_evaluated())
+          return assign(l) = r;
+      impl::stream_store(&l, &r, sizeof l);
+      return l;
+  }
+};
+
+// assign(l, nontemporal) returns assign_nontemporal{l}, for streaming
+template <c_array L>
+constexpr auto assign(L&& l, nontemporal_t) noexcept
+{
+    return std::add_const_t<assign_nontemporal<L&&>>{l};
+}
+
+// saturate_cast<T>(v) converts integer v to integer type T, clamped to
+//   the range of T, c.f. C++26 std::saturate_cast
+//
+template <typename T, typename U>
+  requires (std::is_integral_v<T> && std::is_integral_v<U>
+        && ! same_ish<T,bool> && ! same_ish<U,bool>)
+constexpr T saturate_cast(U v) noexcept
+{
+  if (std::cmp_less(v, std::numeric_limits<T>::min()))
+    return std::numeric_limits<T>::min();
+  if (std::cmp_greater(v, std::numeric_limits<T>::max()))
+    return std::numeric_limits<T>::max();
+  return static_cast<T>(v);
+}
+
+// assign_saturating<c_array> reference-wrapper returned by
+//   assign_saturate(l) for integer array conversion by saturate_cast
+//
+template <c_array L>
+struct assign_saturating
+{
+  L& l;
+
+  using value_type = std::remove_reference_t<L>;
+
+  template <c_array R, typename E = remove_all_extents_t<value_type>,
+            typename F = all_extents_removed_t<R&&>>
+    requires (same_extents<value_type, std::remove_cvref_t<R>>
+           && requires (F f) { saturate_cast<E>(f); }
+           && ! std::is_const_v<E>)
+  constexpr L& operator=(R&& r) const noexcept
+  {
+      auto cvt = [](auto v) { return saturate_cast<E>(v); };
+      if constexpr (impl::convert_assignable_from<L&, R&&>)
+      {
+          if (! std::is_constant_evaluated() && impl::disjoint(l, r))
+          {
+              impl::convert_n<flat_size<L>>(flat_cast(l), flat_cast(r), cvt);
+              return l;
+          }
+      }
+      if (! std::is_constant_evaluated() && impl::overlaps_ahead(l, r))
+      {
+          for (int i = flat_size<L>; i-- != 0; )
+              flat_index(l, i) = cvt(flat_index((R&&)r, i));
+          return l;
+      }
+      for (int i = 0; i != flat_size<L>; ++i)
+          flat_index(l, i) = cvt(flat_index((R&&)r, i));
+      return l;
+  }
+};
+
+// assign_saturate(l) returns assign_saturating{l}, for clamped conversion
+template <c_array L>
+constexpr auto assign_saturate(L&& l) noexcept
+{
+    return std::add_const_t<assign_saturating<L&&>>{l};
+}
+
+// fill(a,v) assigns v to every element of array a, of any rank, and
+//   returns a; constexpr, with memset or broadcast stores at runtime
+//
+template <c_array A, typename V>
+  requires std::is_assignable_v<all_extents_removed_t<A&>, V const&>
+constexpr auto& fill(A&& a, V const& v)
+  noexcept(noexcept(flat_index(a) = v))
+{
+  impl::fill(a, v);
+  return a;
+}
+
+namespace impl {
+
+// block_fits<A,Ext...> true if a block of extents Ext... fits in array A
+//
+template <typename A, std::size_t... Ext, std::size_t... K>
+consteval bool block_fits_in(std::index_sequence<K...>)
+{
+  return ((Ext <= std::extent_v<A,K>) && ...);
+}
+template <typename A, std::size_t... Ext>
+concept block_fits = sizeof...(Ext) == rank_v<std::remove_cvref_t<A>>
+  && block_fits_in<std::remove_cvref_t<A>, Ext...>(
+                   std::make_index_sequence<sizeof...(Ext)>{});
+
+// block_index<N> N indices of a block, from a braced list of integers
+//   of any integral types, e.g. {i,j,k} of int, without narrowing errors
+//   (a negative index converts to a large unsigned index, out of bounds)
+//
+template <std::size_t N>
+struct block_index
+{
+  std::size_t i[N];
+
+  template <std::integral... I>
+    requires (sizeof...(I) == N)
+  constexpr block_index(I... j) noexcept
+    : i{static_cast<std::size_t>(j)...} {}
+};
+
+// copy_block<Ext...>(d,at,s,from) assigns the block of extents Ext... at
+//   index at[] in d from the block at index from[] in s, recursively by
+//   row; a row is one memcpy, at runtime, for same trivially assignable
+//   element types (compiled to vector loads and stores for small rows)
+//
+template <std::size_t E, std::size_t... Ext, typename D, typename S>
+constexpr void copy_block(D& d, std::size_t const* at,
+                          S const& s, std::size_t const* from)
+{
+  if constexpr (sizeof...(Ext) != 0)
+  {
+    for (std::size_t i = 0; i != E; ++i)
+      copy_block<Ext...>(d[at[0] + i], at + 1, s[from[0] + i], from + 1);
+  }
+  else if constexpr (E != 0)
+  {
+    using T = remove_extent_t<D>;
+    if constexpr (std::is_same_v<T, remove_extent_t<S>>
+               && ! std::is_volatile_v<T>
+               && std::is_trivially_copy_assignable_v<T>)
+    {
+      if (! std::is_constant_evaluated())
+      {
+        std::memcpy(&d[at[0]], &s[from[0]], E * sizeof(T));
+        return;
+      }
+    }
+    for (std::size_t j = 0; j != E; ++j)
+      d[at[0] + j] = s[from[0] + j];
+  }
+}
+
+} // impl
+
+// block_in_bounds<Ext...>(a,at) true if the block of extents Ext... at
+//   index at[] is within the bounds of array a, e.g. a tile of an image
+//
+template <std::size_t... Ext, c_array A>
+  requires impl::block_fits<A, Ext...>
+constexpr bool block_in_bounds(A const&,
+                    impl::block_index<sizeof...(Ext)> const& at) noexcept
+{
+  using T = std::remove_cvref_t<A>;
+  return [&]<std::size_t... K>(std::index_sequence<K...>) {
+    return ((at.i[K] <= std::extent_v<T,K> - Ext) && ...);
+  }(std::make_index_sequence<sizeof...(Ext)>{});
+}
+
+// assign_block<Ext...>(dst,at,src,from) assigns a block, or tile, of
+//   compile-time extents Ext... from index from[] of src to index at[]
+//   of dst, arrays of the same rank, e.g. for tiling matrices or images.
+// Unchecked; check block_in_bounds(dst,at) and (src,from) if need be.
+// The blocks must not overlap.
+//
+template <std::size_t... Ext, c_array D, c_array S>
+  requires (impl::block_fits<D, Ext...> && impl::block_fits<S, Ext...>
+         && std::is_assignable_v<all_extents_removed_t<D&>,
+                                 all_extents_removed_t<S const&>>)
+constexpr auto& assign_block(D&& dst,
+                             impl::block_index<sizeof...(Ext)> const& at,
+                             S const& src,
+                             impl::block_index<sizeof...(Ext)> const& from)
+{
+  impl::copy_block<Ext...>(dst, at.i, src, from.i);
+  return dst;
+}
+
+// assign_block<Rows,Cols>(dst,src,r,c) assigns the Rows x Cols tile at
+//   row r, column c of 2D array src to the top left of 2D array dst
+//
+template <std::size_t Rows, std::size_t Cols, c_array D, c_array S>
+  requires (impl::block_fits<D, Rows, Cols>
+         && impl::block_fits<S, Rows, Cols>
+         && std::is_assignable_v<all_extents_removed_t<D&>,
+                                 all_extents_removed_t<S const&>>)
+constexpr auto& assign_block(D&& dst, S const& src,
+                             std::size_t r, std::size_t c)
+{
+  std::size_t const at[2]{}, from[2]{r, c};
+  impl::copy_block<Rows, Cols>(dst, at, src, from);
+  return dst;
+}
+
+namespace impl {
+
+// transposed_extents<D,S> true for 2D arrays D of extents [N][M] and S of
+//   extents [M][N]
+//
+template <typename D, typename S,
+          typename Dv = std::remove_cvref_t<D>,
+          typename Sv = std::remove_cvref_t<S>>
+concept transposed_extents = rank_v<Dv> == 2 && rank_v<Sv> == 2
+  && std::extent_v<Dv> == std::extent_v<remove_extent_t<Sv>>
+  && std::extent_v<remove_extent_t<Dv>> == std::extent_v<Sv>;
+
+inline constexpr std::size_t transpose_leaf = 16;
+
+// transpose_tile<W>(d,dn,s,sn) transposes the 16-byte square tile of W
+//   byte elements at s, row stride sn bytes, to d, row stride dn bytes;
+//   4x4 for 32-bit elements, 2x2 for 64-bit, in SSE2 registers
+//
+#ifdef SIMD_SSE2
+template <std::size_t W>
+inline void transpose_tile(unsigned char* d, std::size_t dn,
+                           unsigned char const* s, std::size_t sn)
+  noexcept
+{
+  auto ld = [](unsigned char const* p) {
+    return _mm_loadu_si128(reinterpret_cast<__m128i const*>(p)); };
+  auto st = [](unsigned char* p, __m128i v) {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); };
+  if constexpr (W == 4)
+  {
+    __m128i r0 = ld(s), r1 = ld(s + sn), r2 = ld(s + 2*sn), r3 = ld(s + 3*sn);
+    __m128i t0 = _mm_unpacklo_epi32(r0, r1), t1 = _mm_unpacklo_epi32(r2, r3),
+            t2 = _mm_unpackhi_epi32(r0, r1), t3 = _mm_unpackhi_epi32(r2, r3);
+    st(d,        _mm_unpacklo_epi64(t0, t1));
+    st(d + dn,   _mm_unpackhi_epi64(t0, t1));
+    st(d + 2*dn, _mm_unpacklo_epi64(t2, t3));
+    st(d + 3*dn, _mm_unpackhi_epi64(t2, t3));
+  }
+  else
+  {
+    __m128i r0 = ld(s), r1 = ld(s + sn);
+    st(d,      _mm_unpacklo_epi64(r0, r1));
+    st(d + dn, _mm_unpackhi_epi64(r0, r1));
+  }
+}
+#endif
+
+// transpose_block(d,s,i0,i1,j0,j1) assigns d[j][i] = s[i][j] for i in
+//   [i0,i1), j in [j0,j1); cache-oblivious, halving the longer side down
+//   to leaf blocks of at most 16 x 16, in which same 4 or 8 byte element
+//   types are transposed by SSE2 register tiles, if enabled
+//
+template <typename D, typename S>
+void transpose_block(D& d, S const& s, std::size_t i0, std::size_t i1,
+                                       std::size_t j0, std::size_t j1)
+{
+  if (i1 - i0 > transpose_leaf || j1 - j0 > transpose_leaf)
+  {
+    // split at a multiple of 4 to keep the register tiles whole
+    if (i1 - i0 >= j1 - j0)
+    {
+      std::size_t im = i0 + (((i1 - i0) / 2 + 3) & ~std::size_t{3});
+      transpose_block(d, s, i0, im, j0, j1);
+      transpose_block(d, s, im, i1, j0, j1);
+    }
+    else
+    {
+      std::size_t jm = j0 + (((j1 - j0) / 2 + 3) & ~std::size_t{3});
+      transpose_block(d, s, i0, i1, j0, jm);
+      transpose_block(d, s, i0, i1, jm, j1);
+    }
+    return;
+  }
+  std::size_t i = i0;
+#ifdef SIMD_SSE2
+  using E = remove_all_extents_t<D>;
+  if constexpr (std::is_same_v<E, remove_all_extents_t<S>>
+             && (sizeof(E) == 4 || sizeof(E) == 8)
+             && ! std::is_volatile_v<E>
+             && std::is_trivially_copy_assignable_v<E>)
+  {
+    constexpr std::size_t T = 16 / sizeof(E);
+    constexpr std::size_t dn = sizeof d[0], sn = sizeof s[0];
+    auto dp = reinterpret_cast<unsigned char*>(&d);
+    auto sp = reinterpret_cast<unsigned char const*>(&s);
+    for (i = i0; i1 - i >= T; i += T)
+      for (std::size_t jt = j0; j1 - jt >= T; jt += T)
+        transpose_tile<sizeof(E)>(dp + jt*dn + i*sizeof(E), dn,
+                                  sp + i*sn + jt*sizeof(E), sn);
+    std::size_t const j = j0 + (j1 - j0) / T * T;
+    // remainder columns [j,j1) of the tiled rows [i0,i)
+    for (std::size_t r = i0; r != i; ++r)
+      for (std::size_t c = j; c != j1; ++c)
+        d[c][r] = s[r][c];
+  }
+#endif
+  // remainder rows [i,i1), all columns
+  for (; i != i1; ++i)
+    for (std::size_t c = j0; c != j1; ++c)
+      d[c][i] = s[i][c];
+}
+
+} // impl
+
+// assign_transposed(dst,src) assigns dst[j][i] = src[i][j], for arrays
+//   dst of extents [N][M] and src [M][N], and returns dst.
+// At runtime the copy is cache-oblivious, by recursive halving to small
+// blocks, with 4x4 (32-bit) or 2x2 (64-bit) SSE2 register transposes.
+// The arrays must not overlap.
+//
+template <c_array D, c_array S>
+  requires (impl::transposed_extents<D,S>
+         && std::is_assignable_v<all_extents_removed_t<D&>,
+                                 all_extents_removed_t<S const&>>)
+constexpr auto& assign_transposed(D&& dst, S const& src)
+{
+  constexpr auto M = std::extent_v<std::remove_cvref_t<S>>,
+                 N = std::extent_v<remove_extent_t<std::remove_cvref_t<S>>>;
+  if constexpr (M != 0 && N != 0)
+  {
+    if (std::is_constant_evaluated())
+    {
+      for (std::size_t i = 0; i != M; ++i)
+        for (std::size_t j = 0; j != N; ++j)
+          dst[j][i] = src[i][j];
+    }
+    else
+      impl::transpose_block(dst, src, 0, M, 0, N);
+  }
+  return dst;
+}
+
+namespace impl {
+
+// swap_bytes(a,b,n) swaps the n bytes at a and b, 64 bytes per iteration
+//   through two fixed-size temporaries, compiled to vector loads, loads,
+//   stores and stores, then 16, then single bytes
+//
+inline void swap_bytes(void* ap, void* bp, std::size_t n) noexcept
+{
+  auto a = static_cast<unsigned char*>(ap);
+  auto b = static_cast<unsigned char*>(bp);
+  std::size_t i = 0;
+  auto swap_word = [&]<std::size_t W>() {
+    word_bytes<W> ta, tb;
+    std::memcpy(&ta, a + i, W);
+    std::memcpy(&tb, b + i, W);
+    std::memcpy(a + i, &tb, W);
+    std::memcpy(b + i, &ta, W);
+  };
+  for (; n - i >= 64; i += 64)
+    swap_word.template operator()<64>();
+  for (; n - i >= 16; i += 16)
+    swap_word.template operator()<16>();
+  for (; i != n; ++i)
+    swap_word.template operator()<1>();
+}
+
+} // impl
+
+// swap_arrays(a,b) swaps the elements of arrays a and b of the same
+//   extents; constexpr, by std::ranges::swap of each element, or by
+//   chunked vector swap of bytes at runtime for same-type trivially
+//   copyable elements (a no-op for zero-size arrays)
+//
+template <c_array A, c_array B>
+  requires (same_extents<std::remove_cvref_t<A>, std::remove_cvref_t<B>>
+         && std::swappable_with<all_extents_removed_t<A&>,
+                                all_extents_removed_t<B&>>)
+constexpr void swap_arrays(A&& a, B&& b)
+  noexcept(noexcept(std::ranges::swap(flat_index(a), flat_index(b))))
+{
+  using E = remove_all_extents_t<std::remove_reference_t<A>>;
+  if constexpr (c_array_unpadded<A> && c_array_unpadded<B>
+             && std::is_same_v<E, remove_all_extents_t<
+                                  std::remove_reference_t<B>>>
+             && ! std::is_volatile_v<E>
+             && std::is_trivially_copyable_v<E>
+             && std::is_trivially_copy_assignable_v<E>)
+  {
+    if (! std::is_constant_evaluated())
+    {
+      impl::swap_bytes(&a, &b, sizeof a);
+      return;
+    }
+  }
+  for (int i = 0; i != flat_size<A>; ++i)
+    std::ranges::swap(flat_index(a, i), flat_index(b, i));
+}
+
 template <c_array L, typename...T>
   requires (assignable_from<extent_removed_t<L>,T> && ...)
 constexpr auto& assign_elements(L&& t, T&&...v)
@@ -321,6 +1135,9 @@ constexpr auto& assign_elements(L&& t, T&&...v)
   return t;
 }
 
+#undef UINTPTR
+#undef SIMD_SSE2
+
 #include "namespace.hpp"
 
 #endif // LML_C_ARRAY_ASSIGN_HPP
@@ -13,12 +13,29 @@
   extended to support C arrays. Only same-size, same shape, arrays are
   considered comparable. Multidimensional arrays compare as-if flat.
 
-  Depends on <compare> and c_array_support.hpp
+  Depends on <compare>, <cstring> and c_array_support.hpp
 
   Avoids <algorithm> or <functional> dependency, implementing algorithms
   similar to std::lexicographical_compare_three_way and ranges equality
-  for same-shape C arrays by flat indexing rather than by recursion
-  (currently lacking optimizations such as memcmp specializations).
+  for same-shape C arrays by flat indexing rather than by recursion.
+
+  Optimizations:
+    equal_to uses memcmp, at runtime, for unpadded arrays of the same
+    integral, enum or pointer element type with unique representation
+    (for which value equality is object representation equality).
+    Arrays of at most 64 bytes, e.g. char[16] or int[3][3], are instead
+    compared by straight-line overlapping word or SSE2 vector compares.
+    compare_three_way and less on same-type integral arrays find the
+    first mismatching byte with a vector compare (SSE2/AVX2 if enabled,
+    else 64-bit words) then order only the element that contains it.
+    Arrays of unsigned byte type; unsigned char, char8_t, std::byte or
+    char if unsigned, are ordered by memcmp, lexicographic by bytes.
+    Same-type floating-point arrays find the first element that is not
+    == with vector compares, so NaN is unordered and -0.0 == +0.0 as in
+    the element loop, then order only that element.
+    Arrays of at most 64 bytes find the first mismatch, for mismatch,
+    compare_three_way and less, by the same straight-line word loads,
+    XOR and count-trailing-zeros, or unrolled floating point compares.
 
   Concepts:
 
@@ -29,11 +46,20 @@
   Aliases:
     lml::compare_three_way_result_t c.f. std::compare_three_way_result_t
 
+  Algorithms:
+    lml::mismatch(l,r)  flat index of the first mismatch, c.f. std
+    lml::find_row(t,k)    index of the first row t[i] equal to k
+    lml::count_rows(t,k)  number of rows t[i] equal to k
+    lml::match_rows(t,k)  row_mask<R> with bit i set iff t[i] equal to k
+    lml::equals<K>(a)     equal_to(a,K), for array constant K, e.g. "GET"
+
   Functors:
     lml::compare_three_way     c.f. std::compare_three_way
     lml::equal_to              c.f. std::ranges::equal_to
     lml::not_equal_to          c.f. std::ranges::not_equal_to
     lml::less                  c.f. std::ranges::less
+    lml::bitwise_equal_to      memcmp(&l,&r,sizeof l) == 0, opt-in
+    lml::bitwise_compare       memcmp(&l,&r,sizeof l) <=> 0, opt-in
 
   Usage
   =====
@@ -74,7 +100,11 @@
    future and then fixed. Hopefully this header is a stopgap till then.)
 */
 
+#include <bit>
 #include <compare>
+#include <cstddef>
+#include <cstring>
+#include <utility>
 
 #include "c_array_support.hpp"
 
@@ -85,6 +115,16 @@
 #  define UINTPTR __UINTPTR_TYPE__
 #endif
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#  define SIMD_AVX2
+#endif
+#if defined(__SSE2__) || defined(_M_X64) \
+ || (defined(_M_IX86_FP) && _M_IX86_FP == 2)
+#include <emmintrin.h>
+#  define SIMD_SSE2
+#endif
+
 #include "namespace.hpp"
 
 // Comparison concepts from std lib extended to include array type
@@ -171,8 +211,382 @@ concept pointer_less_than_comparable_with =
       && ! requires(P&& l, Q&& r)
            { static_cast<P&&>(l).operator<(static_cast<Q&&>(r)); }
      );
+
+// bitwise_equality_element<E> true if == on E is a builtin comparison
+//   equivalent to comparing object representations; i.e. an integral,
+//   pointer or enum type (with no operator== overload) that has unique
+//   object representations
+//
+template <typename E>
+concept bitwise_equality_element =
+     ! std::is_volatile_v<E>
+  && std::has_unique_object_representations_v<E>
+  && (std::is_integral_v<E> || std::is_pointer_v<E>
+      || (std::is_enum_v<E> && ! requires (E e) { operator==(e,e); }));
+
+// bitwise_equality_comparable_with<L,R>
+//   A helper concept for memcmp specializations; true for same-shape
+//   unpadded arrays of the same bitwise_equality_element type
+//
+template <typename L, typename R,
+          typename E = remove_all_extents_t<std::remove_reference_t<L>>>
+concept bitwise_equality_comparable_with =
+     c_array_unpadded<L> && c_array_unpadded<R>
+  && same_extents<std::remove_cvref_t<L>,std::remove_cvref_t<R>>
+  && std::is_same_v<std::remove_cv_t<E>, std::remove_cv_t<
+                    remove_all_extents_t<std::remove_reference_t<R>>>>
+  && bitwise_equality_element<E>
+  && bitwise_equality_element<
+                    remove_all_extents_t<std::remove_reference_t<R>>>;
+
+// mismatch_bytes(l,r,n) returns the offset of the first byte at which
+//   the n-byte object representations at l and r differ, or n if equal.
+// A vector compare plus count-trailing-zeros of the mask of equal bytes
+// finds the first mismatch in a 32 or 16 byte block, 64-bit words else.
+//
+inline auto mismatch_bytes(void const* lp, void const* rp, std::size_t n)
+  noexcept
+{
+  auto l = static_cast<unsigned char const*>(lp);
+  auto r = static_cast<unsigned char const*>(rp);
+  std::size_t i = 0;
+#ifdef SIMD_AVX2
+  for (; i + 32 <= n; i += 32)
+  {
+    auto eq = _mm256_cmpeq_epi8(
+                _mm256_loadu_si256(reinterpret_cast<__m256i const*>(l+i)),
+                _mm256_loadu_si256(reinterpret_cast<__m256i const*>(r+i)));
+    if (auto ne = ~static_cast<unsigned>(_mm256_movemask_epi8(eq)))
+      return i + std::countr_zero(ne);
+  }
+#endif
+#ifdef SIMD_SSE2
+  for (; i + 16 <= n; i += 16)
+  {
+    auto eq = _mm_cmpeq_epi8(
+                _mm_loadu_si128(reinterpret_cast<__m128i const*>(l+i)),
+                _mm_loadu_si128(reinterpret_cast<__m128i const*>(r+i)));
+    if (auto ne = 0xffffu ^ static_cast<unsigned>(_mm_movemask_epi8(eq)))
+      return i + std::countr_zero(ne);
+  }
+#endif
+  using word = unsigned long long;
+  for (; i + sizeof(word) <= n; i += sizeof(word))
+  {
+    word a, b;
+    std::memcpy(&a, l + i, sizeof a);
+    std::memcpy(&b, r + i, sizeof b);
+    if (word ne = a ^ b)
+      return i + (std::endian::native == std::endian::little
+                  ? std::countr_zero(ne) : std::countl_zero(ne)) / 8;
+  }
+  for (; i != n; ++i)
+    if (l[i] != r[i])
+      return i;
+  return n;
+}
+
+
+template <std::size_t W>
+using uint_of_size = std::conditional_t<W == 1, unsigned char,
+                     std::conditional_t<W == 2, unsigned short,
+                     std::conditional_t<W == 4, unsigned,
+                                                unsigned long long>>>;
+
+inline constexpr std::size_t small_equal_bytes = 64;
+
+// small_equal<S>(l,r) true if the S <= 64 bytes at l and r are equal, by
+//   a straight-line sequence of fixed-width word loads and compares,
+//   16-byte SSE2 vectors or 8, 4, 2 or 1 byte words, the last load
+//   overlapping the previous for odd sizes; no call, no loop
+//
+template <std::size_t S>
+inline bool small_equal(void const* lp, void const* rp) noexcept
+{
+  static_assert(S <= small_equal_bytes);
+  auto l = static_cast<unsigned char const*>(lp);
+  auto r = static_cast<unsigned char const*>(rp);
+#ifdef SIMD_SSE2
+  constexpr std::size_t V = 16;
+#else
+  constexpr std::size_t V = 8;
+#endif
+  constexpr std::size_t W = S >= V ? V : S >= 8 ? 8 : S >= 4 ? 4
+                          : S >= 2 ? 2 : 1;
+  constexpr std::size_t K = S == 0 ? 0 : (S + W - 1) / W;
+  return [=]<std::size_t... k>(std::index_sequence<k...>) {
+    constexpr std::size_t at[K ? K : 1]{(k + 1 == K ? S - W : k*W)...};
+    if constexpr (K == 0)
+      return true;
+#ifdef SIMD_SSE2
+    else if constexpr (W == 16)
+    {
+      auto eq = [&](std::size_t o) {
+        return _mm_cmpeq_epi8(
+                 _mm_loadu_si128(reinterpret_cast<__m128i const*>(l+o)),
+                 _mm_loadu_si128(reinterpret_cast<__m128i const*>(r+o)));
+      };
+      __m128i all = _mm_set1_epi8(-1);
+      ((all = _mm_and_si128(all, eq(at[k]))), ...);
+      return _mm_movemask_epi8(all) == 0xffff;
+    }
+#endif
+    else
+    {
+      using word = uint_of_size<W>;
+      auto ne = [&](std::size_t o) {
+        word a, b;
+        std::memcpy(&a, l + o, W);
+        std::memcpy(&b, r + o, W);
+        return a ^ b;
+      };
+      return (ne(at[k]) | ...) == 0;
+    }
+  }(std::make_index_sequence<K>{});
+}
+
+// small_mismatch<S>(l,r) returns the offset of the first byte at which
+//   the S <= 64 bytes at l and r differ, or S if equal; the counterpart
+//   of small_equal, by the same fixed-width word loads, XOR per word and
+//   count-trailing-zeros of the first nonzero word; no call, no loop.
+// The overlapping last word can't report an earlier byte, as the bytes
+//   of the previous words are equal when it is reached.
+//
+template <std::size_t S>
+inline std::size_t small_mismatch(void const* lp, void const* rp)
+  noexcept
+{
+  static_assert(S <= small_equal_bytes);
+  auto l = static_cast<unsigned char const*>(lp);
+  auto r = static_cast<unsigned char const*>(rp);
+#ifdef SIMD_SSE2
+  constexpr std::size_t V = 16;
+#else
+  constexpr std::size_t V = 8;
+#endif
+  constexpr std::size_t W = S >= V ? V : S >= 8 ? 8 : S >= 4 ? 4
+                          : S >= 2 ? 2 : 1;
+  constexpr std::size_t K = S == 0 ? 0 : (S + W - 1) / W;
+  return [=]<std::size_t... k>(std::index_sequence<k...>) {
+    constexpr std::size_t at[K ? K : 1]{(k + 1 == K ? S - W : k*W)...};
+    std::size_t m = S;
+    if constexpr (K == 0)
+      return m;
+#ifdef SIMD_SSE2
+    else if constexpr (W == 16)
+    {
+      auto ne = [&](std::size_t o) {
+        auto eq = _mm_cmpeq_epi8(
+                 _mm_loadu_si128(reinterpret_cast<__m128i const*>(l+o)),
+                 _mm_loadu_si128(reinterpret_cast<__m128i const*>(r+o)));
+        return 0xffffu ^ static_cast<unsigned>(_mm_movemask_epi8(eq));
+      };
+      unsigned x = 0;
+      (((x = ne(at[k])) != 0 && (m = at[k] + std::countr_zero(x), true))
+       || ...);
+      return m;
+    }
+#endif
+    else
+    {
+      using word = uint_of_size<W>;
+      auto ne = [&](std::size_t o) {
+        word a, b;
+        std::memcpy(&a, l + o, W);
+        std::memcpy(&b, r + o, W);
+        return static_cast<word>(a ^ b);
+      };
+      word x = 0;
+      (((x = ne(at[k])) != 0
+        && (m = at[k] + (std::endian::native == std::endian::little
+                         ? std::countr_zero(x) : std::countl_zero(x)) / 8,
+            true))
+       || ...);
+      return m;
+    }
+  }(std::make_index_sequence<K>{});
+}
+
+// small_mismatch_floating<N>(l,r) returns the index of the first of N
+//   floating point elements, of at most 64 bytes, at which l[i] == r[i]
+//   is false, else N; an unrolled sequence of compares, no call, no loop
+//
+template <std::size_t N, typename E>
+inline std::size_t small_mismatch_floating(E const* l, E const* r)
+  noexcept
+{
+  return [=]<std::size_t... k>(std::index_sequence<k...>) {
+    std::size_t m = N;
+    (void)((l[k] == r[k] || (m = k, false)) && ...);
+    return m;
+  }(std::make_index_sequence<N>{});
+}
+
+// small_byte_compare<S>(l,r) returns the difference of the first unequal
+//   bytes of the S <= 64 bytes at l and r, as memcmp, by small_mismatch
+//
+template <std::size_t S>
+inline int small_byte_compare(void const* lp, void const* rp) noexcept
+{
+  auto i = small_mismatch<S>(lp, rp);
+  if (i == S)
+    return 0;
+  return static_cast<unsigned char const*>(lp)[i]
+       - static_cast<unsigned char const*>(rp)[i];
+}
+
+// mismatch_floating(l,r,n) returns the index of the first element at
+//   which l[i] == r[i] is false (differing, or NaN), else n if all ==.
+// Vector compares for float and double, if enabled, else blocks of 8
+// elements are compared branch-free, an auto-vectorizable idiom.
+//
+template <typename E>
+auto mismatch_floating(E const* l, E const* r, std::size_t n) noexcept
+{
+  std::size_t i = 0;
+#ifdef SIMD_AVX2
+  if constexpr (std::is_same_v<E,float>)
+    for (; i + 8 <= n; i += 8)
+    {
+      auto eq = _mm256_cmp_ps(_mm256_loadu_ps(l+i), _mm256_loadu_ps(r+i),
+                              _CMP_EQ_OQ);
+      if (auto ne = 0xffu ^ static_cast<unsigned>(_mm256_movemask_ps(eq)))
+        return i + std::countr_zero(ne);
+    }
+  if constexpr (std::is_same_v<E,double>)
+    for (; i + 4 <= n; i += 4)
+    {
+      auto eq = _mm256_cmp_pd(_mm256_loadu_pd(l+i), _mm256_loadu_pd(r+i),
+                              _CMP_EQ_OQ);
+      if (auto ne = 0xfu ^ static_cast<unsigned>(_mm256_movemask_pd(eq)))
+        return i + std::countr_zero(ne);
+    }
+#endif
+#ifdef SIMD_SSE2
+  if constexpr (std::is_same_v<E,float>)
+    for (; i + 4 <= n; i += 4)
+    {
+      auto eq = _mm_cmpeq_ps(_mm_loadu_ps(l+i), _mm_loadu_ps(r+i));
+      if (auto ne = 0xfu ^ static_cast<unsigned>(_mm_movemask_ps(eq)))
+        return i + std::countr_zero(ne);
+    }
+  if constexpr (std::is_same_v<E,double>)
+    for (; i + 2 <= n; i += 2)
+    {
+      auto eq = _mm_cmpeq_pd(_mm_loadu_pd(l+i), _mm_loadu_pd(r+i));
+      if (auto ne = 0x3u ^ static_cast<unsigned>(_mm_movemask_pd(eq)))
+        return i + std::countr_zero(ne);
+    }
+#endif
+  for (; i + 8 <= n; i += 8)
+  {
+    bool eq = true;
+    for (int k = 0; k != 8; ++k)
+      eq &= l[i+k] == r[i+k];
+    if (! eq)
+      break;
+  }
+  for (; i != n; ++i)
+    if (! (l[i] == r[i]))
+      return i;
+  return n;
+}
+
+// floating_comparable_with<L,R>
+//   A helper concept for the mismatch_floating path; true for same-shape
+//   unpadded arrays of the same, non-volatile, floating point type
+//
+template <typename L, typename R,
+          typename E = remove_all_extents_t<std::remove_reference_t<L>>>
+concept floating_comparable_with =
+     c_array_unpadded<L> && c_array_unpadded<R>
+  && same_extents<std::remove_cvref_t<L>,std::remove_cvref_t<R>>
+  && std::is_same_v<std::remove_cv_t<E>, std::remove_cv_t<
+                    remove_all_extents_t<std::remove_reference_t<R>>>>
+  && std::is_floating_point_v<E>
+  && ! std::is_volatile_v<E>
+  && ! std::is_volatile_v<remove_all_extents_t<std::remove_reference_t<R>>>;
+
+// mismatch_ordered_with<L,R>
+//   A helper concept for ordering by lml::mismatch, then by comparing
+//   only the first mismatched elements; bitwise_equality_comparable_with
+//   arrays of integral type, or floating_comparable_with arrays
+//
+template <typename L, typename R>
+concept mismatch_ordered_with =
+     (bitwise_equality_comparable_with<L,R>
+   && std::is_integral_v<remove_all_extents_t<std::remove_cvref_t<L>>>)
+  || floating_comparable_with<L,R>;
+
+// unsigned_byte<E> true for byte types that memcmp compares as values
+//
+template <typename E>
+concept unsigned_byte = same_ish<E,unsigned char> || same_ish<E,char8_t>
+                     || same_ish<E,std::byte>
+                     || (same_ish<E,char> && std::is_unsigned_v<char>);
+
+// byte_lexicographic_comparable_with<L,R>
+//   A helper concept for the memcmp ordering path for arrays of bytes
+//
+template <typename L, typename R>
+concept byte_lexicographic_comparable_with =
+     bitwise_equality_comparable_with<L,R>
+  && unsigned_byte<remove_all_extents_t<std::remove_cvref_t<L>>>;
 } // impl
 
+// mismatch(l,r)
+//   returns the flat index of the first element of l not equal to the
+//   corresponding element of r, or flat_size<L> if all are equal, i.e.
+//   as std::mismatch(flat l, flat r) but as an index, not an iterator.
+// Uses memcmp-like vector kernels for arrays of same integral, pointer,
+// enum or floating point type at runtime, else a flat_index loop.
+//
+template <typename L, typename R>
+  requires equality_comparable_with<L,R>
+constexpr auto mismatch(L&& l, R&& r)
+  noexcept(noexcept(flat_index((L&&)l) == flat_index((R&&)r)))
+{
+  using size_type = std::remove_const_t<decltype(flat_size<L>)>;
+  if constexpr (impl::bitwise_equality_comparable_with<L,R>)
+  {
+    if (! std::is_constant_evaluated())
+    {
+      using E = remove_all_extents_t<std::remove_cvref_t<L>>;
+      if constexpr (sizeof l <= impl::small_equal_bytes)
+        return static_cast<size_type>(
+                impl::small_mismatch<sizeof l>(&l, &r) / sizeof(E));
+      else
+        return static_cast<size_type>(
+                impl::mismatch_bytes(&l, &r, sizeof l) / sizeof(E));
+    }
+  }
+  else if constexpr (impl::floating_comparable_with<L,R>)
+  {
+    if (! std::is_constant_evaluated())
+    {
+      if constexpr (sizeof l <= impl::small_equal_bytes)
+        return static_cast<size_type>(
+                impl::small_mismatch_floating<flat_size<L>>(
+                                        flat_cast(l), flat_cast(r)));
+      else
+        return static_cast<size_type>(
+                impl::mismatch_floating(flat_cast(l), flat_cast(r),
+                                        flat_size<L>));
+    }
+  }
+  size_type i = 0;
+  while (i != flat_size<L> && flat_index((L&&)l,i) == flat_index((R&&)r,i))
+    ++i;
+  return i;
+}
+
+template <typename A>
+constexpr auto mismatch(A const& l, A const& r) noexcept(
+  noexcept(mismatch<A const&, A const&>(l,r)))
+{
+  return mismatch<A const&, A const&>(l,r);
+}
+
 // compare_three_way
 //   A version of std::compare_three_way extended to compare arrays
 //
@@ -189,6 +603,27 @@ struct compare_three_way
       return std::compare_three_way{}((L&&)l, (R&&)r);
     else
     {
+      if constexpr (impl::byte_lexicographic_comparable_with<L,R>)
+      {
+        if (! std::is_constant_evaluated())
+        {
+          if constexpr (sizeof l <= impl::small_equal_bytes)
+            return impl::small_byte_compare<sizeof l>(&l, &r) <=> 0;
+          else
+            return std::memcmp(&l, &r, sizeof l) <=> 0;
+        }
+      }
+      else if constexpr (impl::mismatch_ordered_with<L,R>)
+      {
+        if (! std::is_constant_evaluated())
+        {
+          auto i = mismatch((L&&)l, (R&&)r);
+          if (i == flat_size<L>)
+            return compare_three_way_result_t<L,R>::equivalent;
+          return std::compare_three_way{}(flat_index((L&&)l,i),
+                                          flat_index((R&&)r,i));
+        }
+      }
       for (int i = 0; i != flat_size<L>; ++i)
       {
         auto c = std::compare_three_way{}(flat_index((L&&)l,i),
@@ -225,6 +660,21 @@ struct equal_to
       return (L&&)l == (R&&)r;
     else
     {
+      if constexpr (impl::bitwise_equality_comparable_with<L,R>)
+      {
+        if (! std::is_constant_evaluated())
+        {
+          if constexpr (sizeof l <= impl::small_equal_bytes)
+            return impl::small_equal<sizeof l>(&l, &r);
+          else
+            return std::memcmp(&l, &r, sizeof l) == 0;
+        }
+      }
+      else if constexpr (impl::floating_comparable_with<L,R>)
+      {
+        if (! std::is_constant_evaluated())
+          return mismatch((L&&)l, (R&&)r) == flat_size<L>;
+      }
       for (int i = 0; i != flat_size<L>; ++i)
         if ( flat_index((L&&)l,i) != flat_index((R&&)r,i) )
           return false;
@@ -297,6 +747,25 @@ struct less
     }
     else
     {
+      if constexpr (impl::byte_lexicographic_comparable_with<L,R>)
+      {
+        if (! std::is_constant_evaluated())
+        {
+          if constexpr (sizeof l <= impl::small_equal_bytes)
+            return impl::small_byte_compare<sizeof l>(&l, &r) < 0;
+          else
+            return std::memcmp(&l, &r, sizeof l) < 0;
+        }
+      }
+      else if constexpr (impl::mismatch_ordered_with<L,R>)
+      {
+        if (! std::is_constant_evaluated())
+        {
+          auto i = mismatch((L&&)l, (R&&)r);
+          return i != flat_size<L>
+              && flat_index((L&&)l,i) < flat_index((R&&)r,i);
+        }
+      }
       for (int i = 0; i != flat_size<L>; ++i)
         if ( flat_index((L&&)l,i) != flat_index((R&&)r,i) )
           return flat_index((L&&)l,i) < flat_index((R&&)r,i);
@@ -314,7 +783,410 @@ struct less
   using is_transparent = void;
 };
 
+namespace impl {
+
+template <std::size_t S>
+struct byte_array { unsigned char b[S]; };
+
+// bitwise_comparable_with<L,R>
+//   A helper concept for the bitwise functors; true for unpadded arrays
+//   of the same flat size and same, non-volatile, trivially copyable
+//   element type (of any shape; the flat_cast arrays are compared)
+//
+template <typename L, typename R,
+          typename E = remove_all_extents_t<std::remove_reference_t<L>>>
+concept bitwise_comparable_with =
+     c_array_unpadded<L> && c_array_unpadded<R>
+  && flat_size<L> == flat_size<R>
+  && std::is_same_v<std::remove_cv_t<E>, std::remove_cv_t<
+                    remove_all_extents_t<std::remove_reference_t<R>>>>
+  && std::is_trivially_copyable_v<E>
+  && ! std::is_volatile_v<E>
+  && ! std::is_volatile_v<remove_all_extents_t<std::remove_reference_t<R>>>;
+
+// bitwise_compare_constexpr(l,r) compares the object representations of
+//   the elements of l and r, in flat order then byte order, as memcmp,
+//   by std::bit_cast; for constant evaluation of the bitwise functors
+//
+template <typename L, typename R>
+constexpr int bitwise_compare_constexpr(L const& l, R const& r) noexcept
+{
+  using E = std::remove_cv_t<all_extents_removed_t<L>>;
+  for (int i = 0; i != flat_size<L>; ++i)
+  {
+    auto lb = std::bit_cast<byte_array<sizeof(E)>>(flat_index(l,i));
+    auto rb = std::bit_cast<byte_array<sizeof(E)>>(flat_index(r,i));
+    for (std::size_t j = 0; j != sizeof(E); ++j)
+      if (lb.b[j] != rb.b[j])
+        return lb.b[j] < rb.b[j] ? -1 : 1;
+  }
+  return 0;
+}
+
+} // impl
+
+// bitwise_equal_to functor compares the object representations of arrays
+//   by memcmp, for unpadded arrays of the same trivially copyable element
+//   type and flat size. Opt-in, as it differs from equal_to for floating
+//   point, -0.0 != +0.0 and same-bits NaN are equal, and for classes with
+//   padding bytes or with an operator== that is not memberwise bitwise.
+//
+struct bitwise_equal_to
+{
+  template <typename L, typename R>
+    requires impl::bitwise_comparable_with<L,R>
+  constexpr bool operator()(L const& l, R const& r) const noexcept
+  {
+    if (std::is_constant_evaluated())
+      return impl::bitwise_compare_constexpr(l,r) == 0;
+    if constexpr (sizeof l <= impl::small_equal_bytes)
+      return impl::small_equal<sizeof l>(&l, &r);
+    else
+      return std::memcmp(&l, &r, sizeof l) == 0;
+  }
+
+  template <typename A>
+    requires impl::bitwise_comparable_with<A,A>
+  constexpr bool operator()(A const& l, A const& r) const noexcept
+  {
+    return operator()<A,A>(l,r);
+  }
+
+  using is_transparent = void;
+};
+
+// bitwise_compare functor orders arrays by object representation as
+//   memcmp, returning std::strong_ordering, under the same constraints
+//   as bitwise_equal_to; an arbitrary but consistent total order
+//
+struct bitwise_compare
+{
+  template <typename L, typename R>
+    requires impl::bitwise_comparable_with<L,R>
+  constexpr std::strong_ordering operator()(L const& l, R const& r)
+    const noexcept
+  {
+    if (std::is_constant_evaluated())
+      return impl::bitwise_compare_constexpr(l,r) <=> 0;
+    return std::memcmp(&l, &r, sizeof l) <=> 0;
+  }
+
+  template <typename A>
+    requires impl::bitwise_comparable_with<A,A>
+  constexpr std::strong_ordering operator()(A const& l, A const& r)
+    const noexcept
+  {
+    return operator()<A,A>(l,r);
+  }
+
+  using is_transparent = void;
+};
+
+namespace impl {
+
+// row_match_bits<S,B>(m) reduces a mask of equal bytes in a B-byte block
+//   of S-byte rows to a mask with bit S*j set iff all of row j is equal
+//
+template <std::size_t S, std::size_t B = 16>
+constexpr unsigned row_match_bits(unsigned m) noexcept
+{
+  unsigned stride = 0;
+  for (std::size_t w = 1; w < S; w *= 2)
+    m &= m >> w;
+  for (std::size_t j = 0; j < B; j += S)
+    stride |= 1u << j;
+  return m & stride;
+}
+
+// for_matching_rows<S>(t,n,key,f) calls f(i) for each row i in order,
+//   of the n rows of S bytes at t, that is equal to the S bytes at key,
+//   while f returns true. The key is held in vector registers:
+//   Rows of 1, 2, 4, 8 or 16 bytes are compared 32 bytes at a time with
+//   AVX2, the key repeated in both lanes, and 16 bytes at a time with
+//   SSE2 (the AVX2 tail). Rows of 32 or 64 bytes are compared by 1 or 2
+//   AVX2 vector compares, ANDed, else by 2 to 4 SSE2 (also 48 bytes).
+//   Other row sizes are compared by one memcmp per row.
+//
+template <std::size_t S, typename F>
+void for_matching_rows(unsigned char const* t, std::size_t n,
+                       unsigned char const* key, F f)
+{
+  std::size_t i = 0;
+#ifdef SIMD_SSE2
+  [[maybe_unused]] unsigned char kb[16];
+  if constexpr (S != 0 && 16 % S == 0)
+    for (std::size_t b = 0; b != 16; ++b)
+      kb[b] = key[b % S];
+#endif
+#ifdef SIMD_AVX2
+  if constexpr (S != 0 && 16 % S == 0)
+  {
+    constexpr auto rows = 32 / S; // rows per vector
+    auto const k = _mm256_broadcastsi128_si256(
+                     _mm_loadu_si128(reinterpret_cast<__m128i const*>(kb)));
+    for (; i + rows <= n; i += rows)
+    {
+      auto p = t + i * S;
+      if (i * S + 8 * 32 < n * S)
+        _mm_prefetch(reinterpret_cast<char const*>(p + 8 * 32),
+                     _MM_HINT_T0);
+      auto eq = _mm256_cmpeq_epi8(
+             _mm256_loadu_si256(reinterpret_cast<__m256i const*>(p)), k);
+      auto r = row_match_bits<S,32>(
+                  static_cast<unsigned>(_mm256_movemask_epi8(eq)));
+      for (; r; r &= r - 1)
+        if (! f(i + std::countr_zero(r) / S))
+          return;
+    }
+  }
+  else if constexpr (S == 32 || S == 64)
+  {
+    constexpr auto V = S / 32; // vectors per row
+    __m256i k[V];
+    for (std::size_t v = 0; v != V; ++v)
+      k[v] = _mm256_loadu_si256(
+               reinterpret_cast<__m256i const*>(key + v * 32));
+    for (; i != n; ++i)
+    {
+      auto p = reinterpret_cast<__m256i const*>(t + i * S);
+      auto eq = _mm256_cmpeq_epi8(_mm256_loadu_si256(p), k[0]);
+      for (std::size_t v = 1; v != V; ++v)
+        eq = _mm256_and_si256(eq,
+               _mm256_cmpeq_epi8(_mm256_loadu_si256(p + v), k[v]));
+      if (_mm256_movemask_epi8(eq) == -1)
+        if (! f(i))
+          return;
+    }
+  }
+#endif
+#ifdef SIMD_SSE2
+  if constexpr (S != 0 && 16 % S == 0)
+  {
+    constexpr auto rows = 16 / S; // rows per vector
+    auto const k = _mm_loadu_si128(reinterpret_cast<__m128i const*>(kb));
+    for (; i + rows <= n; i += rows)
+    {
+      auto p = t + i * S;
+      if (i * S + 8 * 16 < n * S)
+        _mm_prefetch(reinterpret_cast<char const*>(p + 8 * 16),
+                     _MM_HINT_T0);
+      auto eq = _mm_cmpeq_epi8(
+                  _mm_loadu_si128(reinterpret_cast<__m128i const*>(p)), k);
+      auto r = row_match_bits<S>(
+                  static_cast<unsigned>(_mm_movemask_epi8(eq)));
+      for (; r; r &= r - 1)
+        if (! f(i + std::countr_zero(r) / S))
+          return;
+    }
+  }
+  else if constexpr (S == 32 || S == 48 || S == 64)
+  {
+    constexpr auto V = S / 16; // vectors per row
+    __m128i k[V];
+    for (std::size_t v = 0; v != V; ++v)
+      k[v] = _mm_loadu_si128(
+               reinterpret_cast<__m128i const*>(key + v * 16));
+    for (; i != n; ++i)
+    {
+      auto p = reinterpret_cast<__m128i const*>(t + i * S);
+      auto eq = _mm_cmpeq_epi8(_mm_loadu_si128(p), k[0]);
+      for (std::size_t v = 1; v != V; ++v)
+        eq = _mm_and_si128(eq,
+               _mm_cmpeq_epi8(_mm_loadu_si128(p + v), k[v]));
+      if (_mm_movemask_epi8(eq) == 0xffff)
+        if (! f(i))
+          return;
+    }
+  }
+#endif
+  for (; i != n; ++i)
+    if (std::memcmp(t + i * S, key, S) == 0)
+      if (! f(i))
+        return;
+}
+
+// rows_comparable_with<T,K> arrays T of rows equality comparable with K
+//
+template <typename T, typename K>
+concept rows_comparable_with = c_array<T>
+     && equality_comparable_with<extent_removed_t<T&>, K&>;
+
+} // impl
+
+// row_mask<R> a bitmask of R bits, returned by match_rows(table,key)
+//
+template <std::size_t R>
+struct row_mask
+{
+  unsigned long long bits[R ? (R + 63) / 64 : 1];
+
+  constexpr bool test(std::size_t i) const noexcept {
+    return bits[i / 64] >> i % 64 & 1;
+  }
+  constexpr void set(std::size_t i) noexcept {
+    bits[i / 64] |= 1ull << i % 64;
+  }
+  constexpr std::size_t count() const noexcept {
+    std::size_t n = 0;
+    for (auto b : bits)
+      n += static_cast<std::size_t>(std::popcount(b));
+    return n;
+  }
+};
+
+namespace impl {
+
+// for_matching_rows(table,key,f) dispatch for find_row, count_rows and
+//   match_rows; to the byte kernel, at runtime, for bitwise comparable
+//   rows, else equal_to each row
+//
+template <typename T, typename K, typename F>
+constexpr void for_matching_rows(T const& table, K const& key, F f)
+{
+  constexpr auto R = std::extent_v<T>;
+  using row = extent_removed_t<T const&>;
+  if constexpr (bitwise_equality_comparable_with<row, K const&>)
+  {
+    if (! std::is_constant_evaluated())
+    {
+      for_matching_rows<sizeof(row)>(
+        reinterpret_cast<unsigned char const*>(&table), R,
+        reinterpret_cast<unsigned char const*>(&key), f);
+      return;
+    }
+  }
+  for (std::size_t i = 0; i != R; ++i)
+    if (equal_to{}(table[i], key))
+      if (! f(i))
+        return;
+}
+
+} // impl
+
+// find_row(table,key) returns the index of the first row of table equal
+//   to key, or the number of rows, extent_v<T>, if no row is equal.
+// The key may be a braced-init list, for the table's row type.
+//
+template <c_array T, typename K = remove_extent_t<T>>
+  requires impl::rows_comparable_with<T,K>
+constexpr auto find_row(T const& table, K const& key)
+{
+  std::size_t r = std::extent_v<T>;
+  impl::for_matching_rows(table, key, [&r](auto i){ r = i; return false; });
+  return r;
+}
+
+// count_rows(table,key) returns the number of rows of table equal to key
+//
+template <c_array T, typename K = remove_extent_t<T>>
+  requires impl::rows_comparable_with<T,K>
+constexpr auto count_rows(T const& table, K const& key)
+{
+  std::size_t n = 0;
+  impl::for_matching_rows(table, key, [&n](auto){ ++n; return true; });
+  return n;
+}
+
+// match_rows(table,key) returns a row_mask with bit i set iff table[i]
+//   is equal to key
+//
+template <c_array T, typename K = remove_extent_t<T>>
+  requires impl::rows_comparable_with<T,K>
+constexpr auto match_rows(T const& table, K const& key)
+{
+  row_mask<std::extent_v<T>> mask{};
+  impl::for_matching_rows(table, key,
+                          [&mask](auto i){ mask.set(i); return true; });
+  return mask;
+}
+
+// c_array_constant<T,N> structural class wrapping an array constant,
+//   T[N] value, for use as a class-type template argument; deduced from
+//   an array argument, e.g. a string literal, or an array constant.
+//
+template <typename T, std::size_t N>
+struct c_array_constant
+{
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  T value[N];
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+
+  constexpr c_array_constant(T const(&a)[N]) noexcept : value{}
+  {
+    for (int i = 0; i != flat_size<T[N]>; ++i)
+      flat_index(value, i) = flat_index(a, i);
+  }
+};
+
+namespace impl {
+
+// constant_word<W>(bytes,off) the W-byte word at offset off of bytes,
+//   as loaded from memory by memcpy, computed at compile time
+//
+template <std::size_t W, std::size_t S>
+constexpr auto constant_word(byte_array<S> const& bytes,
+                             std::size_t off) noexcept
+{
+  byte_array<W> w{};
+  for (std::size_t i = 0; i != W; ++i)
+    w.b[i] = bytes.b[off + i];
+  return std::bit_cast<uint_of_size<W>>(w);
+}
+
+// constant_diff<Bytes,Off>(a) ORs the XOR of successive 8, 4, 2 or 1
+//   byte words of a with the corresponding words of the constant Bytes,
+//   from offset Off, with immediate operands; zero iff all bytes equal
+//
+template <auto Bytes, std::size_t Off = 0>
+inline unsigned long long constant_diff(unsigned char const* a) noexcept
+{
+  constexpr auto S = sizeof Bytes.b;
+  if constexpr (Off == S)
+    return 0;
+  else
+  {
+    constexpr auto W = S - Off >= 8 ? 8 : S - Off >= 4 ? 4
+                     : S - Off >= 2 ? 2 : 1;
+    constexpr auto c = constant_word<W>(Bytes, Off);
+    uint_of_size<W> v;
+    std::memcpy(&v, a + Off, W);
+    return static_cast<unsigned long long>(v ^ c)
+         | constant_diff<Bytes, Off + W>(a);
+  }
+}
+
+} // impl
+
+// equals<K>(a) compares array a with array constant K, equal_to{}(a,K)
+//   e.g. lml::equals<"GET">(buf) or lml::equals<int_array_constant>(a)
+// For bitwise comparable types of size up to 64 bytes the constant is
+// baked in as immediate operands of word compares, e.g. "GET" is one
+// 4-byte compare. Larger or other types use the equal_to fast paths.
+//
+template <c_array_constant K, typename A = decltype(K.value)>
+  requires equality_comparable_with<A const&, decltype(K.value) const&>
+constexpr bool equals(A const& a)
+  noexcept(noexcept(equal_to{}(a, K.value)))
+{
+  using V = decltype(K.value);
+  using E = std::remove_cv_t<remove_all_extents_t<V>>;
+  if constexpr (impl::bitwise_equality_comparable_with<A const&, V const&>
+                && ! std::is_pointer_v<E> && sizeof(V) <= 64)
+  {
+    if (! std::is_constant_evaluated())
+    {
+      constexpr auto bytes = std::bit_cast<impl::byte_array<sizeof(V)>>(
+                                                                K.value);
+      return impl::constant_diff<bytes>(
+                  reinterpret_cast<unsigned char const*>(&a)) == 0;
+    }
+  }
+  return equal_to{}(a, K.value);
+}
+
 #undef UINTPTR
+#undef SIMD_AVX2
+#undef SIMD_SSE2
 
 namespace impl {
 
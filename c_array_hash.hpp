@@ -0,0 +1,200 @@
+/*
+ SPDX-FileCopyrightText: 2023 The Lemuriad <opensource@lemurianlabs.com>
+ SPDX-License-Identifier: BSL-1.0
+ Repo: https://github.com/Lemuriad/c_array_support
+*/
+#ifndef LML_C_ARRAY_HASH_HPP
+#define LML_C_ARRAY_HASH_HPP
+/*
+  c_array_hash.hpp
+  ================
+
+  A hash functor extended to support C arrays, the partner of equal_to
+  for keying unordered containers on array types (or on classes with
+  array members that forward to it).
+
+  Depends on <functional>, for std::hash, and c_array_compare.hpp
+
+  Functor:
+    lml::hash          c.f. std::hash
+
+  Usage
+  =====
+    std::unordered_map<some_key, int, lml::hash, lml::equal_to> map;
+
+    lml::hash{}("hello") == lml::hash{}("hello");  // true
+    lml::hash{}({1,2,3});  // braced-init rvalue array, as for equal_to
+
+  Arrays that compare equal by lml::equal_to give equal hash values:
+
+   * Unpadded arrays of integral, pointer or enum element type, i.e. the
+     types that lml::equal_to compares by memcmp, are hashed in bulk by
+     their object representation with a wyhash-style 64-bit hash, that
+     consumes 48 bytes per iteration in three independent lanes.
+
+   * Other arrays combine the std::hash of each element, in flat order.
+
+   * Non-array types are hashed by std::hash, so lml::hash can be used
+     as a generic hash, as lml::equal_to is a generic equality functor.
+
+  lml::hash is transparent, for lookup with cvref qualified arrays of
+  the key's element type (the hash of a different element type differs,
+  e.g. long[2]{1,2} need not hash as int[2]{1,2} though they're equal).
+*/
+
+#include <functional>
+
+#include "c_array_compare.hpp"
+
+#if defined(_MSC_VER) && defined(_M_X64) && ! defined(__SIZEOF_INT128__)
+#include <intrin.h>
+#endif
+
+#include "namespace.hpp"
+
+namespace impl {
+
+using hash_word = unsigned long long;
+
+inline constexpr hash_word hash_secret[4] = {
+  0xa0761d6478bd642full, 0xe7037ed1a0b428dbull,
+  0x8ebc6af09c88c6e3ull, 0x589965cc75374cc3ull };
+
+// hash_mix(a,b) folds the 128-bit product a*b to 64 bits, lo ^ hi
+//
+inline hash_word hash_mix(hash_word a, hash_word b) noexcept
+{
+#if defined(__SIZEOF_INT128__)
+  __extension__ using uint128 = unsigned __int128;
+  uint128 r = static_cast<uint128>(a) * b;
+  return static_cast<hash_word>(r) ^ static_cast<hash_word>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  hash_word hi, lo = _umul128(a, b, &hi);
+  return lo ^ hi;
+#else
+  hash_word ha = a >> 32, la = a & 0xffffffff,
+            hb = b >> 32, lb = b & 0xffffffff;
+  hash_word hh = ha*hb, hl = ha*lb, lh = la*hb, ll = la*lb;
+  hash_word t = ll + (hl << 32), lo = t + (lh << 32);
+  hash_word hi = hh + (hl >> 32) + (lh >> 32) + (t < ll) + (lo < t);
+  return lo ^ hi;
+#endif
+}
+
+inline hash_word hash_read8(unsigned char const* p) noexcept {
+  hash_word v; std::memcpy(&v, p, 8); return v;
+}
+inline hash_word hash_read4(unsigned char const* p) noexcept {
+  unsigned v; std::memcpy(&v, p, 4); return v;
+}
+
+// hash_bytes(p,n) wyhash-style hash of the n bytes at p
+//
+inline hash_word hash_bytes(void const* vp, std::size_t n,
+                            hash_word seed = 0) noexcept
+{
+  auto p = static_cast<unsigned char const*>(vp);
+  auto& s = hash_secret;
+  seed ^= hash_mix(seed ^ s[0], s[1]);
+  hash_word a, b;
+  if (n <= 16)
+  {
+    if (n >= 4)
+    {
+      auto m = (n >> 3) << 2;
+      a = hash_read4(p) << 32 | hash_read4(p + m);
+      b = hash_read4(p + n - 4) << 32 | hash_read4(p + n - 4 - m);
+    }
+    else if (n > 0)
+    {
+      a = hash_word{p[0]} << 16 | hash_word{p[n >> 1]} << 8 | p[n - 1];
+      b = 0;
+    }
+    else
+      a = b = 0;
+  }
+  else
+  {
+    auto i = n;
+    if (i > 48)
+    {
+      hash_word see1 = seed, see2 = seed;
+      do {
+        seed = hash_mix(hash_read8(p) ^ s[1], hash_read8(p + 8) ^ seed);
+        see1 = hash_mix(hash_read8(p + 16) ^ s[2],
+                        hash_read8(p + 24) ^ see1);
+        see2 = hash_mix(hash_read8(p + 32) ^ s[3],
+                        hash_read8(p + 40) ^ see2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= see1 ^ see2;
+    }
+    for (; i > 16; i -= 16, p += 16)
+      seed = hash_mix(hash_read8(p) ^ s[1], hash_read8(p + 8) ^ seed);
+    a = hash_read8(p + i - 16);
+    b = hash_read8(p + i - 8);
+  }
+  return hash_mix(hash_mix(a ^ s[1], b ^ seed) ^ s[0] ^ n, s[1]);
+}
+
+// bytes_hashable<A> true for arrays hashed by their object representation
+//
+template <typename A>
+concept bytes_hashable = c_array_unpadded<A>
+     && bitwise_equality_element<remove_all_extents_t<
+                                 std::remove_reference_t<A>>>;
+
+// element_hashable<A> true for arrays with std::hash-able element type
+//
+template <typename A>
+concept element_hashable = requires (all_extents_removed_t<A&> e) {
+  std::hash<std::remove_cvref_t<decltype(e)>>{}(e);
+};
+
+} // impl
+
+// hash functor extended to hash arrays by value, consistent with equal_to
+//
+struct hash
+{
+  template <typename A>
+    requires (impl::bytes_hashable<A> || impl::element_hashable<A>)
+  auto operator()(A const& a) const
+    noexcept(impl::bytes_hashable<A> || noexcept(
+             std::hash<std::remove_cv_t<all_extents_removed_t<A>>>{}(
+                                        flat_index(a))))
+    -> std::size_t
+  {
+    if constexpr (! c_array<A>)
+      return std::hash<std::remove_cv_t<A>>{}(a);
+    else if constexpr (impl::bytes_hashable<A>)
+      return static_cast<std::size_t>(
+                            impl::hash_bytes(&a, sizeof a));
+    else
+    {
+      using E = std::remove_cv_t<all_extents_removed_t<A>>;
+      impl::hash_word h = impl::hash_secret[0] ^ flat_size<A>;
+      for (int i = 0; i != flat_size<A>; ++i)
+        h = impl::hash_mix(h ^ std::hash<E>{}(flat_index(a,i)),
+                           impl::hash_secret[1]);
+      return static_cast<std::size_t>(h);
+    }
+  }
+
+  // operator()({...}) overload for 1D array rvalue from braced-init
+  //
+  template <typename E, std::size_t N>
+    requires (impl::bytes_hashable<E[N]> || impl::element_hashable<E[N]>)
+  auto operator()(E const(&a)[N]) const
+    noexcept(noexcept(operator()<E[N]>(a)))
+  {
+    return operator()<E[N]>(a);
+  }
+
+  using is_transparent = void;
+};
+
+#include "namespace.hpp"
+
+#endif // LML_C_ARRAY_HASH_HPP
@@ -0,0 +1,380 @@
+/*
+ SPDX-FileCopyrightText: 2023 The Lemuriad <opensource@lemurianlabs.com>
+ SPDX-License-Identifier: BSL-1.0
+ Repo: https://github.com/Lemuriad/c_array_support
+*/
+#ifndef LML_C_ARRAY_MAP_HPP
+#define LML_C_ARRAY_MAP_HPP
+/*
+  c_array_map.hpp
+  ===============
+
+  An open-addressing flat hash map keyed by fixed-size C arrays.
+
+  Depends on <bit>, <new>, <utility>, c_array_hash.hpp, c_array_assign.hpp
+
+  Class template:
+    lml::c_array_map<Key[N]..., V, Hash = lml::hash, Eq = lml::equal_to>
+
+  Std node-based associative containers can't hold array keys directly,
+  they need a wrapper class, and they allocate a node per element.
+  c_array_map stores keys inline, with values, in a flat slot array.
+
+  Usage
+  =====
+    lml::c_array_map<unsigned[4], int> flows;
+
+    flows[{10,0,0,1}] = 1;               // braced-init array key
+    flows.try_emplace(key, 2);           // returns {V*, inserted}
+    if (int* v = flows.find(key)) ...;   // nullptr if not found
+    flows.erase(key);
+    flows.for_each([](auto const& key, int& v){...});
+
+  Design
+  ======
+  Slots are grouped in sixteens, each with a one-byte control tag that
+  is empty, deleted, or full with 7 bits of the key's hash value.
+  A lookup probes successive groups (with triangular steps) filtering
+  all sixteen tags at once with an SSE2 byte compare (a scalar loop if
+  SSE2 is not enabled), so that keys are only compared, by lml::equal_to
+  memcmp-like fast path, on a tag match. Load factor is at most 7/8.
+
+  The slot array is allocated cache-line aligned (64 bytes).
+  Keys are arrays of trivially copyable element type.
+  Iterators are not provided; use for_each(f) to visit all elements.
+  References to values are invalidated by insertions that rehash.
+*/
+
+#include <bit>
+#include <new>
+#include <utility>
+
+#include "c_array_hash.hpp"
+#include "c_array_assign.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) \
+ || (defined(_M_IX86_FP) && _M_IX86_FP == 2)
+#include <emmintrin.h>
+#  define SIMD_SSE2
+#endif
+
+#include "namespace.hpp"
+
+namespace impl {
+
+// map_ctrl control byte values; full tags are 0..127, the top bit clear
+//
+enum map_ctrl : unsigned char { map_empty = 0x80, map_deleted = 0xfe };
+
+inline constexpr std::size_t map_group_width = 16;
+
+// map_group_match(ctrl,b) returns a bitmask of the positions in the
+//   group of 16 control bytes at ctrl that are equal to byte b
+//
+inline unsigned map_group_match(unsigned char const* ctrl,
+                                unsigned char b) noexcept
+{
+#ifdef SIMD_SSE2
+  auto g = _mm_loadu_si128(reinterpret_cast<__m128i const*>(ctrl));
+  return static_cast<unsigned>(_mm_movemask_epi8(
+                  _mm_cmpeq_epi8(g, _mm_set1_epi8(static_cast<char>(b)))));
+#else
+  unsigned m = 0;
+  for (unsigned i = 0; i != map_group_width; ++i)
+    m |= unsigned{ctrl[i] == b} << i;
+  return m;
+#endif
+}
+
+// map_group_free(ctrl) bitmask of the empty or deleted positions,
+//   i.e. those with the top bit set
+//
+inline unsigned map_group_free(unsigned char const* ctrl) noexcept
+{
+#ifdef SIMD_SSE2
+  return static_cast<unsigned>(_mm_movemask_epi8(
+           _mm_loadu_si128(reinterpret_cast<__m128i const*>(ctrl))));
+#else
+  unsigned m = 0;
+  for (unsigned i = 0; i != map_group_width; ++i)
+    m |= static_cast<unsigned>(ctrl[i] >> 7) << i;
+  return m;
+#endif
+}
+
+} // impl
+
+// c_array_map<K,V,Hash,Eq> open-addressing hash map with C array key K
+//
+template <c_array K, typename V,
+          typename Hash = hash, typename Eq = equal_to>
+  requires (std::is_same_v<K, std::remove_cvref_t<K>>
+         && std::is_trivially_copyable_v<remove_all_extents_t<K>>)
+class c_array_map
+{
+ public:
+  using key_type = K;
+  using mapped_type = V;
+  using size_type = std::size_t;
+  using hasher = Hash;
+  using key_equal = Eq;
+
+  c_array_map() = default;
+
+  explicit c_array_map(size_type n) { reserve(n); }
+
+  c_array_map(c_array_map const& o) : c_array_map()
+  {
+    if (o.size_ == 0)
+      return;
+    allocate(o.capacity_);
+    o.for_each([this](K const& k, V const& v){ insert_new(k, v); });
+  }
+
+  c_array_map(c_array_map&& o) noexcept
+    : ctrl_{std::exchange(o.ctrl_, nullptr)}
+    , slots_{std::exchange(o.slots_, nullptr)}
+    , capacity_{std::exchange(o.capacity_, 0)}
+    , size_{std::exchange(o.size_, 0)}
+    , growth_left_{std::exchange(o.growth_left_, 0)}
+  {}
+
+  c_array_map& operator=(c_array_map o) noexcept
+  {
+    swap(o);
+    return *this;
+  }
+
+  ~c_array_map() { destroy(); }
+
+  void swap(c_array_map& o) noexcept
+  {
+    std::swap(ctrl_, o.ctrl_);
+    std::swap(slots_, o.slots_);
+    std::swap(capacity_, o.capacity_);
+    std::swap(size_, o.size_);
+    std::swap(growth_left_, o.growth_left_);
+  }
+
+  size_type size() const noexcept { return size_; }
+  bool empty() const noexcept { return size_ == 0; }
+  size_type capacity() const noexcept { return capacity_; }
+
+  // find(k) returns a pointer to the value mapped to key k, or nullptr
+  //
+  V* find(K const& k) noexcept(noexcept(find_slot(k)))
+  {
+    auto s = find_slot(k);
+    return s ? &s->value : nullptr;
+  }
+  V const* find(K const& k) const noexcept(noexcept(find_slot(k)))
+  {
+    auto s = find_slot(k);
+    return s ? &s->value : nullptr;
+  }
+
+  bool contains(K const& k) const noexcept(noexcept(find_slot(k)))
+  {
+    return find_slot(k) != nullptr;
+  }
+
+  // try_emplace(k,args...) inserts V(args...) if k is not in the map,
+  // returns {pointer to the value mapped to k, true if inserted}
+  //
+  template <typename... Args>
+  std::pair<V*, bool> try_emplace(K const& k, Args&&... args)
+  {
+    auto h = hasher{}(k);
+    if (auto s = find_slot(k, h))
+      return {&s->value, false};
+    if (growth_left_ == 0) // grow, or purge deleted if it's half empty
+      rehash(size_ + 1 > capacity_ * 7 / 16 ? capacity_ * 2 : capacity_);
+    return {&emplace_new(h, k, (Args&&)args...)->value, true};
+  }
+
+  V& operator[](K const& k)
+  {
+    return *try_emplace(k).first;
+  }
+
+  // erase(k) removes the element with key k, returns true if erased
+  //
+  bool erase(K const& k)
+  {
+    auto s = find_slot(k);
+    if (! s)
+      return false;
+    auto i = static_cast<size_type>(s - slots_);
+    s->~slot();
+    // A probe stops at a group with an empty slot, so that it's safe to
+    // empty a slot in such a group, else mark deleted to probe onwards
+    auto g = i - i % impl::map_group_width;
+    if (impl::map_group_match(ctrl_ + g, impl::map_empty) != 0)
+    {
+      ctrl_[i] = impl::map_empty;
+      ++growth_left_;
+    }
+    else
+      ctrl_[i] = impl::map_deleted;
+    --size_;
+    return true;
+  }
+
+  void clear() noexcept
+  {
+    destroy();
+    ctrl_ = nullptr;
+    slots_ = nullptr;
+    capacity_ = size_ = growth_left_ = 0;
+  }
+
+  // reserve(n) rehashes, if needed, so that n elements fit unrehashed
+  //
+  void reserve(size_type n)
+  {
+    size_type cap = impl::map_group_width;
+    while (cap * 7 / 8 < n)
+      cap *= 2;
+    if (cap > capacity_)
+      rehash(cap);
+  }
+
+  // for_each(f) calls f(key, value) for each element in the map
+  //
+  template <typename F>
+  void for_each(F&& f)
+  {
+    for (size_type i = 0; i != capacity_; ++i)
+      if (ctrl_[i] < impl::map_empty)
+        f(static_cast<K const&>(slots_[i].key), slots_[i].value);
+  }
+  template <typename F>
+  void for_each(F&& f) const
+  {
+    for (size_type i = 0; i != capacity_; ++i)
+      if (ctrl_[i] < impl::map_empty)
+        f(static_cast<K const&>(slots_[i].key),
+          static_cast<V const&>(slots_[i].value));
+  }
+
+ private:
+  struct slot
+  {
+    K key;
+    V value;
+  };
+
+  static constexpr std::align_val_t slot_align {
+               alignof(slot) > 64 ? alignof(slot) : 64 };
+
+  unsigned char* ctrl_ = nullptr;
+  slot* slots_ = nullptr;
+  size_type capacity_ = 0;
+  size_type size_ = 0;
+  size_type growth_left_ = 0;
+
+  static constexpr unsigned char tag(size_type h) noexcept {
+    return static_cast<unsigned char>(h & 0x7f);
+  }
+
+  slot* find_slot(K const& k) const
+    noexcept(noexcept(hasher{}(k)) && noexcept(key_equal{}(k,k)))
+  {
+    return find_slot(k, hasher{}(k));
+  }
+
+  slot* find_slot(K const& k, size_type h) const
+    noexcept(noexcept(key_equal{}(k,k)))
+  {
+    if (capacity_ == 0)
+      return nullptr;
+    auto const mask = capacity_ / impl::map_group_width - 1;
+    auto g = (h >> 7) & mask;
+    for (size_type step = 1; ; g = (g + step++) & mask)
+    {
+      auto c = ctrl_ + g * impl::map_group_width;
+      for (auto m = impl::map_group_match(c, tag(h)); m; m &= m - 1)
+      {
+        auto s = slots_ + g * impl::map_group_width + std::countr_zero(m);
+        if (key_equal{}(s->key, k))
+          return s;
+      }
+      if (impl::map_group_match(c, impl::map_empty))
+        return nullptr;
+      if (step > mask)
+        return nullptr;
+    }
+  }
+
+  // free_index(h) returns the index of the first free slot for hash h
+  //
+  size_type free_index(size_type h) const noexcept
+  {
+    auto const mask = capacity_ / impl::map_group_width - 1;
+    auto g = (h >> 7) & mask;
+    for (size_type step = 1; ; g = (g + step++) & mask)
+      if (auto m = impl::map_group_free(ctrl_ + g*impl::map_group_width))
+        return g * impl::map_group_width + std::countr_zero(m);
+  }
+
+  template <typename... Args>
+  slot* emplace_new(size_type h, K const& k, Args&&... args)
+  {
+    auto i = free_index(h);
+    auto s = slots_ + i;
+    ::new (static_cast<void*>(&s->value)) V((Args&&)args...);
+    ::new (static_cast<void*>(&s->key)) K;
+    assign(s->key) = k; // trivially copyable, so nothrow
+    growth_left_ -= ctrl_[i] == impl::map_empty;
+    ctrl_[i] = tag(h);
+    ++size_;
+    return s;
+  }
+
+  template <typename W>
+  void insert_new(K const& k, W&& v)
+  {
+    emplace_new(hasher{}(k), k, (W&&)v);
+  }
+
+  void allocate(size_type cap)
+  {
+    slots_ = static_cast<slot*>(::operator new(cap * sizeof(slot),
+                                               slot_align));
+    ctrl_ = new unsigned char[cap];
+    for (size_type i = 0; i != cap; ++i)
+      ctrl_[i] = impl::map_empty;
+    capacity_ = cap;
+    growth_left_ = cap * 7 / 8;
+    size_ = 0;
+  }
+
+  void destroy() noexcept
+  {
+    if (! ctrl_)
+      return;
+    for (size_type i = 0; i != capacity_; ++i)
+      if (ctrl_[i] < impl::map_empty)
+        slots_[i].~slot();
+    ::operator delete(slots_, slot_align);
+    delete[] ctrl_;
+  }
+
+  void rehash(size_type cap)
+  {
+    if (cap == 0)
+      cap = impl::map_group_width;
+    c_array_map m;
+    m.allocate(cap);
+    for (size_type i = 0; i != capacity_; ++i)
+      if (ctrl_[i] < impl::map_empty)
+        m.insert_new(slots_[i].key, std::move(slots_[i].value));
+    swap(m);
+  }
+};
+
+#undef SIMD_SSE2
+
+#include "namespace.hpp"
+
+#endif // LML_C_ARRAY_MAP_HPP
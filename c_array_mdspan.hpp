@@ -0,0 +1,133 @@
+/*
+ SPDX-FileCopyrightText: 2023 The Lemuriad <opensource@lemurianlabs.com>
+ SPDX-License-Identifier: BSL-1.0
+ Repo: https://github.com/Lemuriad/c_array_support
+*/
+#ifndef LML_C_ARRAY_MDSPAN_HPP
+#define LML_C_ARRAY_MDSPAN_HPP
+/*
+  c_array_mdspan.hpp
+  ==================
+
+  std::mdspan interop for C arrays, with fully static extents.
+
+  Depends on <mdspan>, <utility> and "c_array_support.hpp".
+  The header is empty if <mdspan> is not available (__cpp_lib_mdspan);
+  C++23 library support is required.
+
+  Aliases:
+    lml::mdspan_extents_t<A>    std::extents<size_t, L, M, N> of T[L][M][N]
+    lml::mdspan_t<A>            std::mdspan<T, mdspan_extents_t<A>>
+    lml::extents_c_array_t<T,X> T[L][M][N] from static std::extents X
+
+  Functions:
+    lml::to_mdspan(a)    returns mdspan_t<A> viewing lvalue array a
+    lml::from_mdspan(m)  returns array reference to the elements of m
+
+  Usage
+  =====
+    float a[4][8][2];
+    auto m = lml::to_mdspan(a);   // mdspan<float, extents<size_t,4,8,2>>
+    m[3,7,1] == a[3][7][1];       // layout_right, same as nested array
+
+    float (&r)[4][8][2] = lml::from_mdspan(m);
+
+  All extents are static, so the mdspan holds only the data pointer, with
+  no extents storage, and its index arithmetic is constant-folded.
+  A non-array lvalue gives a rank 0 mdspan, and zero-size arrays give
+  mdspan of zero size(). Only unpadded arrays are accepted, as for
+  flat_cast, and the data pointer is that of flat_cast(a).
+
+  from_mdspan is the reverse, for a mdspan with static extents, default
+  layout_right and default_accessor; a reinterpret_cast, as flat_cast.
+*/
+
+#if __has_include(<mdspan>)
+#include <mdspan>
+#endif
+
+#include "c_array_support.hpp"
+
+#if defined(__cpp_lib_mdspan)
+
+#include <utility>
+
+#include "namespace.hpp"
+
+namespace impl {
+
+template <typename A, typename = std::make_index_sequence<rank_v<A>>>
+struct mdspan_extents;
+//
+template <typename A, std::size_t... K>
+struct mdspan_extents<A, std::index_sequence<K...>> {
+  static constexpr auto x = impl::extents<A>();
+  using type = std::extents<std::size_t, x[K]...>;
+};
+
+template <typename T, typename X>
+struct extents_c_array;
+//
+template <typename T, typename I, std::size_t... E>
+  requires ((E != std::dynamic_extent) && ...)
+struct extents_c_array<T, std::extents<I, E...>> {
+  using type = c_array_t<T, E...>;
+};
+
+} // impl
+
+// mdspan_extents_t<A> the static std::extents of array type A
+//                e.g. mdspan_extents_t<int[2][3]> -> extents<size_t,2,3>
+//                     mdspan_extents_t<int> -> extents<size_t>
+template <typename A>
+using mdspan_extents_t =
+      typename impl::mdspan_extents<std::remove_cvref_t<A>>::type;
+
+// mdspan_t<A> the mdspan type of array A, element cv preserved
+//           e.g. mdspan_t<int const(&)[2][3]>
+//             -> mdspan<int const, extents<size_t,2,3>>
+template <typename A>
+using mdspan_t = std::mdspan<remove_all_extents_t<
+                             std::remove_reference_t<A>>,
+                             mdspan_extents_t<A>>;
+
+// extents_c_array_t<T,X> array type with element T and static extents X
+//           e.g. extents_c_array_t<int, extents<size_t,2,3>> -> int[2][3]
+template <typename T, typename X>
+using extents_c_array_t = typename impl::extents_c_array<T,X>::type;
+
+// to_mdspan(a) returns mdspan_t<A> viewing lvalue a, an unpadded array
+//              or a non-array object for a rank 0 mdspan
+//
+template <typename A>
+  requires (c_array_unpadded<A> || ! is_array_v<A>)
+constexpr auto to_mdspan(A& a) noexcept -> mdspan_t<A>
+{
+  using E = remove_all_extents_t<A>;
+  if constexpr (c_array<A> && rank_v<A> != 1 && flat_size<A> == 0)
+    return mdspan_t<A>(reinterpret_cast<E*>(&a)); // no E[0] flat_cast_t
+  else if constexpr (c_array<A>)
+    return mdspan_t<A>(flat_cast(a));
+  else
+    return mdspan_t<A>(&a);
+}
+
+// from_mdspan(m) returns a reference to the array viewed by mdspan m,
+//                of static extents, layout_right and default accessor
+//
+template <typename T, typename X>
+  requires (X::rank_dynamic() == 0)
+constexpr auto from_mdspan(std::mdspan<T, X> const& m) noexcept
+  -> extents_c_array_t<T, X>&
+{
+  if constexpr (X::rank() == 0)
+    return *m.data_handle();
+  else
+    return reinterpret_cast<extents_c_array_t<T, X>&>(*m.data_handle());
+}
+
+#include "namespace.hpp"
+
+#endif // __cpp_lib_mdspan
+
+#endif // LML_C_ARRAY_MDSPAN_HPP
@@ -0,0 +1,420 @@
+/*
+ SPDX-FileCopyrightText: 2023 The Lemuriad <opensource@lemurianlabs.com>
+ SPDX-License-Identifier: BSL-1.0
+ Repo: https://github.com/Lemuriad/c_array_support
+*/
+#ifndef LML_C_ARRAY_SLICE_HPP
+#define LML_C_ARRAY_SLICE_HPP
+/*
+  c_array_slice.hpp
+  =================
+
+  Zero-copy strided slice views of possibly nested C arrays; a column,
+  every other row, or a [2:6] window, compared and assigned in place.
+
+  Depends on <array>, <compare>, <cstring>, <iterator>, <ranges>,
+  "c_array_compare.hpp" and "c_array_assign.hpp".
+
+  Class template:
+    lml::slice_view<E,R>    rank R strided view of elements of type E
+
+  Functions:
+    lml::slice(a)                          view of all of array a
+    lml::slice(a,dim,start,count,stride=1) view of a sliced along dim
+    s.slice(dim,start,count,stride=1)      view of s sliced along dim
+
+  Usage
+  =====
+    float m[512][512];
+    auto col = lml::slice(m, 1, 7, 1);       // m[0..512)[7], extents 512,1
+    auto odd = lml::slice(m, 0, 1, 256, 2);  // m[1], m[3], ... m[511]
+    auto win = lml::slice(m, 0, 2, 4).slice(1, 2, 4);  // m[2:6][2:6]
+
+    lml::assign(win) = lml::slice(n);        // copy in, n is float[4][4]
+    lml::assign(lml::slice(n)) = win;        // copy out
+    lml::assign(col) = {};                   // clear a column
+    lml::equal_to{}(win, lml::slice(n));     // compare in place
+
+  A slice_view<E,R> is a pointer to its first element and R extents and
+  strides (in elements), so the rank and element type are static, from
+  the array type, and the shape is dynamic. Slicing along a dimension
+  keeps the rank; count is the new extent, start the offset and stride
+  the step; e.g. a column has extent 1 in its sliced dimension.
+
+  Iteration is in row-major order of the view, by incrementing the last
+  index with carry, adding the precomputed strides; no division.
+
+  Comparison: slice_views with the same extents compare elementwise by
+  == and <=>, lexicographically in iteration order; views of different
+  shape are unequal and are ordered by their extents. So lml::equal_to,
+  lml::less, lml::compare_three_way accept pairs of slice_view, being
+  equality_comparable and three_way_comparable types. Wrap arrays with
+  lml::slice(a) to compare them with a view.
+
+  Assignment: lml::assign(s) = r assigns elementwise from a slice_view,
+  or an array, r of the same rank and extents, assign(s) = {} clears and
+  assign(s).fill(v) fills. Rows with unit inner stride are copied by one
+  memmove and compared by one memcmp, for same trivially copyable, or
+  bitwise comparable, element types.
+
+  Extents and indices are not checked, as for the builtin subscript;
+  assign(s) = r requires r of the same extents as s, unchecked.
+  Overlapping source and target views, other than within a row, are not
+  supported. Views do not own the elements; a view must not outlive its
+  array. Views are usable in constant expressions when made by pointer,
+  extents and strides, or from a rank 1 array; slice(a) of a multi-
+  dimensional array is runtime-only (as flat_cast).
+*/
+
+#include <array>
+#include <compare>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+
+#include "c_array_compare.hpp"
+#include "c_array_assign.hpp"
+
+#include "namespace.hpp"
+
+template <typename E, int R>
+  requires (R > 0 && ! std::is_reference_v<E> && ! is_array_v<E>)
+class slice_view;
+
+namespace impl {
+
+// for_each_row(l,r,f) calls f(lrow, rrow, n, lstride, rstride) for each
+//   innermost row of same-extents views l and r, in order, while f
+//   returns true; the outer indices advance with carry, adding strides
+//   to element offsets, so no pointer is formed outside the arrays
+//
+template <typename E, typename F, int R, typename Fn>
+constexpr void for_each_row(slice_view<E,R> const& l,
+                            slice_view<F,R> const& r, Fn f)
+{
+  using index_type = std::ptrdiff_t;
+  auto& x = l.extents();
+  auto& ls = l.strides();
+  auto& rs = r.strides();
+  if (l.empty())
+    return;
+  index_type lo = 0, ro = 0;
+  std::array<index_type, R> i{};
+  for (;;)
+  {
+    if (! f(l.data() + lo, r.data() + ro, x[R-1], ls[R-1], rs[R-1]))
+      return;
+    int d = R - 2;
+    for (; d >= 0; --d)
+    {
+      if (++i[d] != x[d]) {
+        lo += ls[d];
+        ro += rs[d];
+        break;
+      }
+      lo -= (x[d] - 1) * ls[d];
+      ro -= (x[d] - 1) * rs[d];
+      i[d] = 0;
+    }
+    if (d < 0)
+      return;
+  }
+}
+
+template <typename S>
+inline constexpr bool is_slice_view = false;
+//
+template <typename E, int R>
+inline constexpr bool is_slice_view<slice_view<E,R>> = true;
+
+} // impl
+
+// slice_view<E,R> view of rank R with element type E, possibly cv, by
+//   pointer to the first element with R extents and strides
+//
+template <typename E, int R>
+  requires (R > 0 && ! std::is_reference_v<E> && ! is_array_v<E>)
+class slice_view : public std::ranges::view_interface<slice_view<E,R>>
+{
+ public:
+  using element_type = E;
+  using value_type = std::remove_cv_t<E>;
+  using index_type = std::ptrdiff_t;
+  using size_type = std::size_t;
+  using shape_type = std::array<index_type, R>;
+
+ private:
+  E* p_ = nullptr;
+  shape_type ext_{}, str_{};
+
+ public:
+  class iterator;
+
+  slice_view() = default;
+
+  // slice_view(p,ext,str) view of elements p[i*str[0] + j*str[1] ...]
+  //
+  constexpr slice_view(E* p, shape_type const& ext,
+                             shape_type const& str) noexcept
+    : p_{p}, ext_{ext}, str_{str} {}
+
+  // slice_view(a) view of all of unpadded array lvalue a, of rank R
+  //
+  template <c_array_unpadded A>
+    requires (rank_v<std::remove_cv_t<A>> == R
+           && std::is_convertible_v<remove_all_extents_t<A>(*)[], E(*)[]>)
+  constexpr slice_view(A& a) noexcept
+  {
+    constexpr auto x = impl::extents<std::remove_cv_t<A>>();
+    index_type s = 1;
+    for (int d = R; d-- != 0; ) {
+      ext_[d] = static_cast<index_type>(x[d]);
+      str_[d] = s;
+      s *= ext_[d];
+    }
+    if constexpr (flat_size<A> != 0)
+      p_ = flat_cast(a);
+  }
+
+  // slice_view<E const,R>(slice_view<E,R>) conversion adding const
+  //
+  template <typename F>
+    requires (! std::is_same_v<F, E>
+           && std::is_convertible_v<F(*)[], E(*)[]>)
+  constexpr slice_view(slice_view<F,R> const& s) noexcept
+    : p_{s.data()}, ext_{s.extents()}, str_{s.strides()} {}
+
+  static constexpr int rank() noexcept { return R; }
+
+  constexpr E* data() const noexcept { return p_; }
+  constexpr shape_type const& extents() const noexcept { return ext_; }
+  constexpr shape_type const& strides() const noexcept { return str_; }
+  constexpr index_type extent(int d) const noexcept { return ext_[d]; }
+  constexpr index_type stride(int d) const noexcept { return str_[d]; }
+
+  constexpr size_type size() const noexcept {
+    index_type n = 1;
+    for (auto x : ext_)
+      n *= x;
+    return static_cast<size_type>(n);
+  }
+  constexpr bool empty() const noexcept { return size() == 0; }
+
+  // operator()(i,j...) returns the element at indices i,j... unchecked
+  //
+  template <std::integral... I>
+    requires (sizeof...(I) == R)
+  constexpr E& operator()(I... i) const noexcept {
+    int d = 0;
+    index_type off = 0;
+    ((off += static_cast<index_type>(i) * str_[d++]), ...);
+    return p_[off];
+  }
+
+  // slice(dim,start,count,stride) view of elements start, start+stride,
+  //   ... count in all, along dimension dim, unchecked
+  //
+  constexpr slice_view slice(int dim, index_type start, index_type count,
+                             index_type stride = 1) const noexcept
+  {
+    slice_view s = *this;
+    if (count != 0 && ! empty())
+      s.p_ += start * str_[dim];
+    s.ext_[dim] = count;
+    s.str_[dim] *= stride;
+    return s;
+  }
+
+  constexpr iterator begin() const noexcept {
+    return empty() ? end() : iterator{*this, 0};
+  }
+  constexpr iterator end() const noexcept {
+    return iterator{*this, static_cast<index_type>(size())};
+  }
+
+  friend constexpr bool operator==(slice_view const& l,
+                                   slice_view<E const,R> const& r)
+    noexcept(noexcept(std::declval<E&>() == std::declval<E&>()))
+    requires std::equality_comparable<value_type>
+  {
+    if (l.extents() != r.extents())
+      return false;
+    bool eq = true;
+    impl::for_each_row(l, r, [&](E* lr, E const* rr, index_type n,
+                                 index_type ls, index_type rs) {
+      if constexpr (impl::bitwise_equality_element<E>)
+        if (ls == 1 && rs == 1 && ! std::is_constant_evaluated())
+          return eq = std::memcmp(lr, rr, sizeof(E) * n) == 0;
+      for (index_type j = 0; j != n; ++j)
+        if (! (lr[j*ls] == rr[j*rs]))
+          return eq = false;
+      return true;
+    });
+    return eq;
+  }
+
+  friend constexpr auto operator<=>(slice_view const& l,
+                                    slice_view<E const,R> const& r)
+    requires std::three_way_comparable<value_type>
+  {
+    using C = std::compare_three_way_result_t<value_type>;
+    if (auto c = l.extents() <=> r.extents(); c != 0)
+      return C{c};
+    C c = C::equivalent;
+    impl::for_each_row(l, r, [&](E* lr, E const* rr, index_type n,
+                                 index_type ls, index_type rs) {
+      for (index_type j = 0; j != n; ++j)
+        if ((c = lr[j*ls] <=> rr[j*rs]) != 0)
+          return false;
+      return true;
+    });
+    return c;
+  }
+};
+
+// slice_view<E,R>::iterator forward iterator in row-major order,
+//   advanced by the last index, with carry, adding strides to an offset
+//   from the view's data pointer, only formed to dereference
+//
+template <typename E, int R>
+  requires (R > 0 && ! std::is_reference_v<E> && ! is_array_v<E>)
+class slice_view<E,R>::iterator
+{
+  slice_view v_;
+  shape_type i_{};
+  index_type off_ = 0; // element offset from v_.p_
+  index_type k_ = 0;   // flat count, for comparison
+
+ public:
+  using value_type = std::remove_cv_t<E>;
+  using difference_type = std::ptrdiff_t;
+  using iterator_concept = std::forward_iterator_tag;
+  using iterator_category = std::forward_iterator_tag;
+
+  iterator() = default;
+
+  constexpr iterator(slice_view const& v, index_type k) noexcept
+    : v_{v}, k_{k} {}
+
+  constexpr E& operator*() const noexcept { return v_.p_[off_]; }
+  constexpr E* operator->() const noexcept { return v_.p_ + off_; }
+
+  constexpr iterator& operator++() noexcept
+  {
+    ++k_;
+    for (int d = R; d-- != 0; )
+    {
+      if (++i_[d] != v_.ext_[d] || d == 0) {
+        off_ += v_.str_[d];
+        break;
+      }
+      off_ -= (v_.ext_[d] - 1) * v_.str_[d];
+      i_[d] = 0;
+    }
+    return *this;
+  }
+  constexpr iterator operator++(int) noexcept {
+    auto t = *this; ++*this; return t;
+  }
+
+  friend constexpr bool operator==(iterator const& l,
+                                   iterator const& r) noexcept {
+    return l.k_ == r.k_;
+  }
+};
+
+// slice(a) returns the slice_view of all of unpadded array lvalue a
+//
+template <c_array_unpadded A>
+constexpr auto slice(A& a) noexcept
+  -> slice_view<remove_all_extents_t<A>, rank_v<std::remove_cv_t<A>>>
+{
+  return {a};
+}
+
+// slice(a,dim,start,count,stride) slice_view of lvalue array a sliced
+//   along dimension dim; count elements from start, step stride
+//
+template <c_array_unpadded A>
+constexpr auto slice(A& a, int dim, std::ptrdiff_t start,
+                     std::ptrdiff_t count, std::ptrdiff_t stride = 1)
+  noexcept
+{
+  return slice(a).slice(dim, start, count, stride);
+}
+
+// assign_to<slice_view> specialization, assign(s) = r for slice_view s
+//   assigns elementwise from slice_view or array r of the same extents
+//
+template <typename S>
+  requires impl::is_slice_view<std::remove_cvref_t<S>>
+struct assign_to<S>
+{
+  using view = std::remove_cvref_t<S>;
+  using E = typename view::element_type;
+  static constexpr int R = view::rank();
+
+  view const& l;
+
+  // operator=(r) unchecked; r must have the same extents as l,
+  //   check l.extents() == r.extents() if need be
+  //
+  template <typename F>
+    requires std::is_assignable_v<E&, F&>
+  constexpr view const& operator=(slice_view<F,R> const& r) const
+  {
+    impl::for_each_row(l, r, [](E* lr, F* rr, std::ptrdiff_t n,
+                                std::ptrdiff_t ls, std::ptrdiff_t rs) {
+      if constexpr (std::is_same_v<std::remove_cv_t<F>, E>
+                 && ! std::is_volatile_v<E> && ! std::is_volatile_v<F>
+                 && std::is_trivially_copy_assignable_v<E>)
+        if (ls == 1 && rs == 1 && ! std::is_constant_evaluated()) {
+          std::memmove(lr, rr, sizeof(E) * n);
+          return true;
+        }
+      for (std::ptrdiff_t j = 0; j != n; ++j)
+        lr[j*ls] = rr[j*rs];
+      return true;
+    });
+    return l;
+  }
+
+  template <c_array_unpadded A>
+    requires (rank_v<std::remove_cv_t<A>> == R
+           && std::is_assignable_v<E&, all_extents_removed_t<A&>>)
+  constexpr view const& operator=(A& r) const
+  {
+    return *this = slice(r);
+  }
+
+  constexpr view const& operator=(std::initializer_list<impl::empty_list>)
+    const requires empty_list_assignable<E&>
+  {
+    return fill(E{});
+  }
+
+  template <typename V>
+    requires std::is_assignable_v<E&, V const&>
+  constexpr view const& fill(V const& v) const
+  {
+    impl::for_each_row(l, l, [&](E* lr, E*, std::ptrdiff_t n,
+                                 std::ptrdiff_t ls, std::ptrdiff_t) {
+      for (std::ptrdiff_t j = 0; j != n; ++j)
+        lr[j*ls] = v;
+      return true;
+    });
+    return l;
+  }
+};
+
+#include "namespace.hpp"
+
+// slice_view iterators point into the array, so outlive the view
+//
+namespace std::ranges {
+template <typename E, int R>
+inline constexpr bool enable_borrowed_range<NAMESPACE_ID::slice_view<E,R>>
+  = true;
+}
+
+#endif // LML_C_ARRAY_SLICE_HPP
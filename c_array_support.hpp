@@ -11,7 +11,7 @@
 
   c_array concept, type traits and utilities for handing C arrays.
 
-  Depends on std <type_traits> and uses C++20 features.
+  Depends on std <type_traits>, <array> and uses C++20 features.
 
   C arrays are hard to handle, multidimensional arrays especially.
   Generic code ought to handle arrays but they're often neglected.
@@ -48,13 +48,21 @@
   - extent_removed_t<A>: remove_extent, under any reference qualifier
   - all_extents_removed_t<T>: remove_all_extents, under any ref qual
   - flat_cast_t<A>: type of the flattened array A preserving cvref quals
+  - md_index_t<A,K>: type of A indexed by K indices, preserving cvref
+  - reshape_cast_t<S,A>: type of A reshaped to extents of S, with cvref
 
  Functions:
   - flat_cast(a) returns flattened 1D array, preserving cvref quals
+  - reshape_cast<S>(a) returns array a reshaped as S, preserving cvref
   - subscript(a,i): returns a[i], an rvalue if 'a' is an rvalue
   - flat_index(a,i=0): returns element at i in flat_cast(a)
+  - md_index(a,i,j...): returns a[i][j]..., an rvalue if 'a' is rvalue
+  - flat_offset<A>(i,j...): the flat index of a[i][j]..., by strides
+  - unflatten<A>(i): array of the indices of the flat index i element
 */
 
+#include <array>
+
 #include "util_traits.hpp"
 
 #include "namespace.hpp"
@@ -215,6 +223,54 @@ constexpr auto&& flat_cast(A&& a) noexcept {
     return reinterpret_cast<flat_cast_t<A&&>>(a);
 }
 
+// reshape_cast_t<S,A> type of array A reshaped to the extents of S,
+//                     keeping the element and cvref qualifiers of A
+//  e.g. reshape_cast_t<int[6][4], int const(&)[4][6]> -> int const(&)[6][4]
+//
+namespace impl {
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+
+template <typename S, typename E>
+struct reshape { using type = E; };
+//
+template <typename S, typename E> requires is_array_v<S>
+struct reshape<S,E> {
+  using type = typename reshape<remove_extent_t<S>,E>::type
+                                                   [std::extent_v<S>];
+};
+
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+}// impl
+//
+template <c_array S, c_array_unpadded A,
+          typename E = remove_all_extents_t<std::remove_reference_t<A>>>
+  requires (std::is_same_v<S, std::remove_reference_t<S>>
+         && flat_size<S> == flat_size<A>
+         && std::is_same_v<std::remove_cv_t<remove_all_extents_t<S>>,
+                           std::remove_cv_t<E>>)
+using reshape_cast_t = apply_ref_t<A, typename impl::reshape<S,
+                                   apply_cv_t<remove_all_extents_t<S>,E>
+                                   >::type>;
+
+// reshape_cast<S>(a) cast to reshape_cast_t<S,A&&>, a reinterpret_cast
+//   to the same element type, of the same flat_size, in another shape,
+//   e.g. int(&)[4][6] to int(&)[6][4] or int(&)[2][12] or int(&)[24].
+//   Returns a, the identity, for the same shape so can be constexpr.
+//
+// As for flat_cast, only unpadded arrays are accepted; cv qualifiers on
+// the element type of S are added to those of a.
+//
+template <c_array S, c_array_unpadded A>
+  requires requires { typename reshape_cast_t<S,A&&>; }
+constexpr auto reshape_cast(A&& a) noexcept -> reshape_cast_t<S,A&&>
+{
+  using R = reshape_cast_t<S,A&&>;
+  if constexpr (same_extents<S, std::remove_cvref_t<A>>)
+    return static_cast<R>(a);
+  else
+    return reinterpret_cast<R>(a);
+}
+
 // subscript(a,i)
 // returns a[i], an rvalue if argument 'a' is an array rvalue
 //  workaround for MSVC https://developercommunity.visualstudio.com/t/
@@ -249,10 +305,139 @@ constexpr auto& flat_index_recurse(c_array auto& a, auto i)
   else return a[i];
 }
 
+// md_index_t<A,K> type of array A indexed by K indices, preserving ref
+//                e.g. md_index_t<int(&&)[1][2][3],2> -> int(&&)[3]
+//
+namespace impl {
+template <typename A, std::size_t K>
+auto md_index_f() {
+  if constexpr (K == 0)
+    return std::type_identity<A>{};
+  else
+    return md_index_f<extent_removed_t<A>, K - 1>();
+}
+}
+template <c_array A, std::size_t K>
+  requires (K <= rank_v<std::remove_cvref_t<A>>)
+using md_index_t = typename decltype(impl::md_index_f<A,K>())::type;
+
+namespace impl {
+
+// md_subscript(a,i,j...) returns lvalue a[i][j]...
+//
+template <typename A>
+constexpr auto& md_subscript(A& a) noexcept { return a; }
+//
+template <typename A, typename Int, typename... I>
+constexpr auto& md_subscript(A& a, Int i, I... j) noexcept {
+  return md_subscript(a[i], j...);
+}
+
+// md_subscript_at<K>(a,x) returns lvalue a[x[K]][x[K+1]]...
+//
+template <std::size_t K, typename A, typename X>
+constexpr auto& md_subscript_at(A& a, X const& x) noexcept {
+  if constexpr (K == std::tuple_size_v<X>)
+    return a;
+  else
+    return md_subscript_at<K + 1>(a[x[K]], x);
+}
+
+// extents<A>() returns the extents of A as a std::array
+//  (std::extent_v<A,K> is not relied on as it's 0 under a zero extent)
+//
+template <typename A>
+constexpr auto extents() noexcept
+{
+  std::array<std::size_t, rank_v<A>> x{};
+  if constexpr (rank_v<A> != 0)
+  {
+    x[0] = std::extent_v<A>;
+    auto y = extents<remove_extent_t<A>>();
+    for (std::size_t k = 0; k != y.size(); ++k)
+      x[k + 1] = y[k];
+  }
+  return x;
+}
+
+// unflatten_to<A,K>(r,u) assigns indices r[K]...r[0] of flat index u
+//
+template <typename A, std::size_t K>
+constexpr void unflatten_to(auto& r, std::size_t u) noexcept
+{
+  if constexpr (K == 0)
+    r[0] = u;
+  else
+  {
+    constexpr auto N = extents<A>()[K];
+    if constexpr (N != 0) {
+      r[K] = u % N;
+      u /= N;
+    }
+    unflatten_to<A, K - 1>(r, u);
+  }
+}
+
+} // impl
+
+// md_index(a,i,j...)
+//   returns a[i][j]..., indexed by up to rank_v<A> indices, an rvalue if
+//   argument 'a' is an array rvalue. The offset is computed, as for the
+//   nested subscript, by multiplication with compile-time strides.
+//   Indices are not bounds-checked, as for the nested subscript.
+//
+template <c_array A, std::integral... I>
+  requires (sizeof...(I) <= rank_v<std::remove_cvref_t<A>>)
+constexpr auto md_index(A&& a, I... i) noexcept
+           -> md_index_t<A&&, sizeof...(I)>
+{
+  using R = md_index_t<A&&, sizeof...(I)>;
+  return [](R&v)noexcept->R {return R(v);}(impl::md_subscript(a, i...));
+}
+
+// flat_offset<A>(i,j...)
+//   returns the flat index of a[i][j]... in array type A; the sum of the
+//   products of each index with its compile-time stride, the flat_size
+//   of the sub-array it indexes (so, for fewer indices than the rank, the
+//   flat index of the first element of the indexed sub-array)
+//
+template <c_array A, std::integral... I>
+  requires (sizeof...(I) <= rank_v<std::remove_cvref_t<A>>)
+constexpr auto flat_offset(I... i) noexcept -> std::size_t
+{
+  constexpr auto x = impl::extents<std::remove_cvref_t<A>>();
+  std::size_t off = 0, k = 0;
+  ((off = off * x[k++] + static_cast<std::size_t>(i)), ...);
+  for (; k != x.size(); ++k)
+    off *= x[k];
+  return off;
+}
+
+// unflatten<A>(i)
+//   returns, as std::array, the indices of the element of array type A
+//   at flat index i, the inverse of flat_offset<A>; the remainders of
+//   successive unsigned divisions by compile-time constant extents, so
+//   strength-reduced to multiply and shift, or mask for powers of two.
+// The index is of any type convertible to an integer, as for flat_index,
+//   e.g. an unscoped enum, and is converted to an unsigned index.
+//
+template <c_array A, typename Int>
+constexpr auto unflatten(Int i) noexcept
+{
+  constexpr auto x = impl::extents<std::remove_cvref_t<A>>();
+  auto u = static_cast<std::size_t>(i);
+  std::array<std::size_t, x.size()> r{};
+  if constexpr (x.size() != 0)
+    impl::unflatten_to<std::remove_cvref_t<A>, x.size() - 1>(r, u);
+  return r;
+}
+
 // flat_index(a,i)
 //   for non-array a returns a (the identity function, and i is ignored)
 //   else returns the element at index i of the flattened array.
-// Non-constant evaluation avoids div/mod maths, which has poor codegen.
+// Non-constant evaluation avoids div/mod maths, which has poor codegen;
+// constant evaluation, or padded array access, indexes by unflatten(i),
+// one unsigned div/mod by constant per extent.
 // Note that the index is not bounds-checked; constant evaluation fails
 // for out-of-bounds access. Non-constant evaluated access should use
 // static analysis and instrumented runs to check for bounds errors.
@@ -267,28 +452,10 @@ constexpr auto flat_index(A&& a, Int i = 0) noexcept
     return mover(a);
   else if (std::is_constant_evaluated() || ! c_array_unpadded<A>)
   {
-    using E = std::remove_cvref_t<decltype(a[0])>;
-
-    if constexpr (rank_v<E> == 0) {
+    if constexpr (rank_v<std::remove_cvref_t<A>> == 1)
       return mover(a[i]);
-    }
-    else if constexpr (rank_v<E> == 1) {
-      constexpr auto N = std::extent_v<E>;
-      return mover(a[i/N][i%N]);
-    }
-    else if constexpr (rank_v<E> == 2) {
-      constexpr auto M = std::extent_v<E,0>;
-      constexpr auto N = std::extent_v<E,1>;
-      return mover(a[i/N/M][i/N%M][i%N]);
-    }
-    else if constexpr (rank_v<E> == 3) {
-      constexpr auto L = std::extent_v<E,0>;
-      constexpr auto M = std::extent_v<E,1>;
-      constexpr auto N = std::extent_v<E,2>;
-      return mover(a[i/L/M/N][i/N/M%L][i/N%M][i%N]);
-    }
     else
-      return mover(flat_index_recurse(a,i));
+      return mover(impl::md_subscript_at<0>(a, unflatten<A>(i)));
   }
   else
     return mover(flat_cast(a)[i]); // No bounds check
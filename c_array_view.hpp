@@ -0,0 +1,179 @@
+/*
+ SPDX-FileCopyrightText: 2023 The Lemuriad <opensource@lemurianlabs.com>
+ SPDX-License-Identifier: BSL-1.0
+ Repo: https://github.com/Lemuriad/c_array_support
+*/
+#ifndef LML_C_ARRAY_VIEW_HPP
+#define LML_C_ARRAY_VIEW_HPP
+/*
+  c_array_view.hpp
+  ================
+
+  A contiguous flat range view of possibly nested C arrays, so that std
+  algorithms and range-for loops work directly on multidimensional arrays.
+
+  Depends on <compare>, <iterator>, <ranges> and "c_array_support.hpp".
+
+  Class template:
+    lml::flat_view<A>      view of the flattened elements of array A
+
+  Function:
+    lml::flat_view(a)      returns flat_view<A> of lvalue array a
+
+  Usage
+  =====
+    int a[8][8];
+    for (int& e : lml::flat_view(a)) e = 0;
+    std::ranges::sort(lml::flat_view(a));   // constexpr, too
+    std::ranges::contiguous_range<lml::flat_view<int[8][8]>>  // true
+
+  flat_cast(a) gives a flat array reference but reinterpret_cast is not
+  usable in constant evaluation. flat_view(a) is constexpr:
+
+   * For 1D arrays the iterator is the element pointer, E*.
+
+   * For nested arrays the iterator holds the array pointer and a flat
+     index, dereferenced by flat_index(a,i); at runtime that is pointer
+     arithmetic on flat_cast(a), so loops compile as over an E* range,
+     while constant evaluation indexes by nested subscript.
+
+  The element type keeps any cv qualification of the array, as for
+  flat_cast_t. Arrays are viewed by reference so only lvalues are
+  accepted; a view of an rvalue array would dangle. The view is a
+  borrowed range; its iterators stay valid for the array's lifetime.
+  Only unpadded arrays are viewable, as for flat_cast.
+*/
+
+#include <compare>
+#include <iterator>
+#include <ranges>
+
+#include "c_array_support.hpp"
+
+#include "namespace.hpp"
+
+// flat_iterator<A> contiguous iterator over the elements of array A
+//   as a flat array, by array pointer and flat index
+//
+template <c_array_unpadded A>
+  requires std::is_same_v<A, std::remove_reference_t<A>>
+class flat_iterator
+{
+  A* a_ = nullptr;
+  std::ptrdiff_t i_ = 0;
+
+ public:
+  using element_type = remove_all_extents_t<A>;
+  using value_type = std::remove_cv_t<element_type>;
+  using difference_type = std::ptrdiff_t;
+  using iterator_concept = std::contiguous_iterator_tag;
+  using iterator_category = std::random_access_iterator_tag;
+
+  flat_iterator() = default;
+
+  constexpr flat_iterator(A* a, difference_type i) noexcept
+    : a_{a}, i_{i} {}
+
+  constexpr element_type& operator*() const noexcept {
+    return flat_index(*a_, i_);
+  }
+  constexpr element_type* operator->() const noexcept {
+    if (std::is_constant_evaluated())
+      return &flat_index(*a_, i_);
+    return flat_cast(*a_) + i_; // valid for the end iterator too
+  }
+  constexpr element_type& operator[](difference_type n) const noexcept {
+    return flat_index(*a_, i_ + n);
+  }
+
+  constexpr flat_iterator& operator++() noexcept { ++i_; return *this; }
+  constexpr flat_iterator& operator--() noexcept { --i_; return *this; }
+  constexpr flat_iterator operator++(int) noexcept {
+    auto t = *this; ++i_; return t;
+  }
+  constexpr flat_iterator operator--(int) noexcept {
+    auto t = *this; --i_; return t;
+  }
+  constexpr flat_iterator& operator+=(difference_type n) noexcept {
+    i_ += n; return *this;
+  }
+  constexpr flat_iterator& operator-=(difference_type n) noexcept {
+    i_ -= n; return *this;
+  }
+
+  friend constexpr flat_iterator operator+(flat_iterator p,
+                                           difference_type n) noexcept {
+    return p += n;
+  }
+  friend constexpr flat_iterator operator+(difference_type n,
+                                           flat_iterator p) noexcept {
+    return p += n;
+  }
+  friend constexpr flat_iterator operator-(flat_iterator p,
+                                           difference_type n) noexcept {
+    return p -= n;
+  }
+  friend constexpr difference_type operator-(flat_iterator const& l,
+                                     flat_iterator const& r) noexcept {
+    return l.i_ - r.i_;
+  }
+
+  friend constexpr bool operator==(flat_iterator const& l,
+                                   flat_iterator const& r) noexcept {
+    return l.i_ == r.i_;
+  }
+  friend constexpr std::strong_ordering operator<=>(
+           flat_iterator const& l, flat_iterator const& r) noexcept {
+    return l.i_ <=> r.i_;
+  }
+};
+
+// flat_view<A> contiguous range of the elements of array A, flattened
+//
+template <c_array_unpadded A>
+  requires std::is_same_v<A, std::remove_reference_t<A>>
+class flat_view : public std::ranges::view_interface<flat_view<A>>
+{
+  A* a_ = nullptr;
+
+ public:
+  using element_type = remove_all_extents_t<A>;
+  using iterator = std::conditional_t<rank_v<std::remove_cv_t<A>> == 1,
+                                      element_type*, flat_iterator<A>>;
+
+  flat_view() = default;
+
+  constexpr explicit flat_view(A& a) noexcept : a_{&a} {}
+
+  constexpr iterator begin() const noexcept {
+    if constexpr (std::is_pointer_v<iterator>)
+      return *a_;
+    else
+      return {a_, 0};
+  }
+  constexpr iterator end() const noexcept {
+    if constexpr (std::is_pointer_v<iterator>)
+      return *a_ + flat_size<A>;
+    else
+      return {a_, flat_size<A>};
+  }
+
+  static constexpr std::size_t size() noexcept {
+    return flat_size<A>;
+  }
+};
+
+template <c_array_unpadded A>
+flat_view(A&) -> flat_view<A>;
+
+#include "namespace.hpp"
+
+// flat_view borrows the array so its iterators outlive the view
+//
+namespace std::ranges {
+template <typename A>
+inline constexpr bool enable_borrowed_range<NAMESPACE_ID::flat_view<A>>
+  = true;
+}
+
+#endif // LML_C_ARRAY_VIEW_HPP
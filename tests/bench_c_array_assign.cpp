@@ -0,0 +1,95 @@
+// Benchmark the cache pollution of large array assignment on a reader,
+// lml::assign(l) = r against lml::assign(l, lml::nontemporal) = r.
+// A reader thread sums a 'hot' working set, sized to fit in cache, while
+// the main thread repeatedly copies, then clears, a 64 MiB float array.
+// Reader time per pass rises as regular stores evict its working set.
+//
+// Build optimized, e.g. meson setup --buildtype=release, then
+//   meson test --benchmark -v
+
+#include "c_array_assign.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using big = float[4096][4096];
+struct big_array { big a; };
+
+using clock_type = std::chrono::steady_clock;
+
+struct result { double reader_ns_per_pass, writer_gb_per_s; };
+
+unsigned checksum = 0;
+
+// run(write) calls write() repeatedly while a reader sums the hot set
+//
+template <typename W>
+result run(std::vector<unsigned> const& hot, W write)
+{
+  std::atomic<bool> go{false}, stop{false};
+  std::atomic<long> passes{0};
+  std::atomic<double> reader_ns{0};
+  unsigned sum = 0;
+
+  std::thread reader([&]{
+    while (! go) {}
+    auto t0 = clock_type::now();
+    long n = 0;
+    do {
+      for (auto v : hot) sum += v;
+      ++n;
+    } while (! stop);
+    auto t1 = clock_type::now();
+    passes = n;
+    reader_ns = std::chrono::duration<double,std::nano>(t1 - t0).count();
+  });
+
+  int const reps = 8;
+  go = true;
+  auto t0 = clock_type::now();
+  for (int i = 0; i != reps; ++i)
+    write();
+  auto t1 = clock_type::now();
+  stop = true;
+  reader.join();
+
+  auto s = std::chrono::duration<double>(t1 - t0).count();
+  checksum += sum;
+  return {reader_ns / static_cast<double>(passes),
+          reps * sizeof(big) / s / 1e9};
+}
+
+int main()
+{
+  auto src_ = std::make_unique<big_array>();
+  auto dst_ = std::make_unique<big_array>();
+  big& src = src_->a;
+  big& dst = dst_->a;
+  for (int i = 0; i != lml::flat_size<big>; ++i)
+    lml::flat_index(src, i) = static_cast<float>(i);
+
+  std::vector<unsigned> hot(256 * 1024 / sizeof(unsigned), 1);
+
+  auto idle = run(hot, []{ std::this_thread::sleep_for(
+                              std::chrono::milliseconds(20)); });
+  auto copy = run(hot, [&]{ lml::assign(dst) = src; });
+  auto copy_nt = run(hot, [&]{ lml::assign(dst, lml::nontemporal) = src;});
+  auto clear = run(hot, [&]{ lml::assign(dst) = {}; });
+  auto clear_nt = run(hot, [&]{ lml::assign(dst, lml::nontemporal) = {}; });
+
+  std::printf("64 MiB float[4096][4096]   reader ns/pass  writer GB/s\n");
+  std::printf("idle                       %14.0f\n", idle.reader_ns_per_pass);
+  for (auto [name, r] : {std::pair{"assign(l) = r          ", copy},
+                         std::pair{"assign(l, nontemporal)=r", copy_nt},
+                         std::pair{"assign(l) = {}         ", clear},
+                         std::pair{"assign(l, nontemporal)={}", clear_nt}})
+    std::printf("%-26s %14.0f %12.1f\n", name,
+                r.reader_ns_per_pass, r.writer_gb_per_s);
+  std::printf("(checksum %u)\n", checksum);
+  return dst[0][0] != 0.f;
+}
@@ -0,0 +1,77 @@
+// Benchmark c_array_map<unsigned[4],V> against the std node-based map
+// std::unordered_map<std::array<unsigned,4>,V> with the same hash, for
+// inserts, successful lookups and failed lookups of 'flow tuple' keys.
+//
+// Build optimized, e.g. meson setup --buildtype=release, then
+//   meson test --benchmark -v
+
+#include "c_array_map.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <unordered_map>
+#include <vector>
+
+using key = unsigned[4];
+using std_key = std::array<unsigned,4>;
+
+struct std_key_hash {
+  auto operator()(std_key const& k) const {
+    return static_cast<decltype(sizeof 0)>(
+             lml::impl::hash_bytes(k.data(), sizeof k));
+  }
+};
+
+template <typename F>
+double ns_per_op(int n, F f)
+{
+  auto t0 = std::chrono::steady_clock::now();
+  f();
+  auto t1 = std::chrono::steady_clock::now();
+  return std::chrono::duration<double,std::nano>(t1 - t0).count() / n;
+}
+
+int main()
+{
+  constexpr int N = 1 << 20;
+  std::vector<std_key> keys(N), misses(N);
+  unsigned x = 12345;
+  auto rand = [&x]{ x ^= x << 13; x ^= x >> 17; x ^= x << 5; return x; };
+  for (auto& k : keys)   k = {rand(), rand(), rand(), 80};
+  for (auto& k : misses) k = {rand(), rand(), rand(), 81};
+
+  struct row { key k; };
+  std::vector<row> lkeys(N), lmisses(N);
+  for (int i = 0; i != N; ++i)
+    for (int j = 0; j != 4; ++j) {
+      lkeys[i].k[j] = keys[i][j];
+      lmisses[i].k[j] = misses[i][j];
+    }
+
+  lml::c_array_map<key, int> lm;
+  std::unordered_map<std_key, int, std_key_hash> um;
+  long sum = 0;
+
+  auto lm_insert = ns_per_op(N, [&]{
+    for (int i = 0; i != N; ++i) lm.try_emplace(lkeys[i].k, i); });
+  auto um_insert = ns_per_op(N, [&]{
+    for (int i = 0; i != N; ++i) um.try_emplace(keys[i], i); });
+
+  auto lm_hit = ns_per_op(N, [&]{
+    for (auto& r : lkeys) sum += *lm.find(r.k); });
+  auto um_hit = ns_per_op(N, [&]{
+    for (auto& k : keys) sum += um.find(k)->second; });
+
+  auto lm_miss = ns_per_op(N, [&]{
+    for (auto& r : lmisses) sum += lm.contains(r.k); });
+  auto um_miss = ns_per_op(N, [&]{
+    for (auto& k : misses) sum += um.contains(k); });
+
+  std::printf("%d keys unsigned[4]   c_array_map  std::unordered_map\n", N);
+  std::printf("insert   ns/op   %12.1f  %18.1f\n", lm_insert, um_insert);
+  std::printf("find hit ns/op   %12.1f  %18.1f\n", lm_hit, um_hit);
+  std::printf("find miss ns/op  %12.1f  %18.1f\n", lm_miss, um_miss);
+  std::printf("(checksum %ld)\n", sum);
+  return lm.size() != um.size();
+}
@@ -1,6 +1,11 @@
 #include "test_c_array_assign.hpp"
 
 #include <cassert>
+#include <cmath>
+#include <string>
+#include <utility>
+
+#include "c_array_compare.hpp"
 
 bool test_assign_to_array1D()
 {
@@ -71,6 +76,437 @@ bool test_assign_array2D()
   return true;
 }
 
+bool test_assign_memmove()
+{
+  float t[64][64], u[64][64];
+  for (int i = 0; i != 64*64; ++i)
+    lml::flat_index(t, i) = float(i);
+  lml::assign(u) = t;
+  assert( u[0][0] == 0.f && u[63][63] == float(64*64 - 1) );
+  lml::assign(u) = u; // self-assignment, memmove
+  assert( u[1][2] == 66.f );
+
+  char buf[4096]{'a'}, cbuf[4096];
+  lml::assign(cbuf) = buf;
+  assert( cbuf[0] == 'a' && cbuf[4095] == 0 );
+  lml::assign(cbuf) = std::as_const(buf);
+  assert( cbuf[0] == 'a' );
+
+  int const ci[2]{3,4};
+  int i2[2];
+  lml::assign(i2) = ci;
+  assert( i2[0] == 3 && i2[1] == 4 );
+
+  struct nontrivial {
+    int v = 0;
+    nontrivial& operator=(nontrivial const& o) { v = o.v + 1; return *this; }
+  };
+  nontrivial nt[2], nu[2];
+  lml::assign(nu) = nt; // element loop
+  assert( nu[0].v == 1 && nu[1].v == 1 );
+
+  return true;
+}
+
+// Check small_copy<S> for all sizes up to 64 bytes, also overlapping
+template <decltype(sizeof 0)... S>
+void test_small_copy(std::index_sequence<S...>)
+{
+  auto check = []<decltype(sizeof 0) N>() {
+    unsigned char src[80], dst[80]{}, buf[80];
+    for (int i = 0; i != 80; ++i)
+      src[i] = buf[i] = static_cast<unsigned char>(i + 1);
+    lml::impl::small_copy<N>(dst, src);
+    for (decltype(sizeof 0) i = 0; i != 80; ++i)
+      assert( dst[i] == (i < N ? src[i] : 0) );
+    lml::impl::small_copy<N>(buf + 3, buf); // overlapping, as memmove
+    for (decltype(sizeof 0) i = 0; i != N; ++i)
+      assert( buf[i + 3] == src[i] );
+  };
+  (check.template operator()<S>(), ...);
+}
+
+// Shift a window within one array, through flat_cast-like views
+bool test_assign_overlap()
+{
+  std::string h[6]{"a","b","c","d","e","f"};
+  using window = std::string[4];
+  auto& lo = *reinterpret_cast<window*>(h);
+  auto& hi = *reinterpret_cast<window*>(h + 2);
+  lml::assign(hi) = lo; // shift up, backward loop
+  assert( h[2] == "a" && h[3] == "b" && h[4] == "c" && h[5] == "d" );
+  lml::assign(lo) = std::as_const(hi); // shift down, forward loop
+  assert( h[0] == "a" && h[1] == "b" && h[2] == "c" && h[3] == "d" );
+
+  int hist[4][8];
+  for (int i = 0; i != 32; ++i) lml::flat_index(hist, i) = i;
+  using rows3 = int[3][8];
+  auto& older = *reinterpret_cast<rows3*>(hist[1]);
+  auto& newer = *reinterpret_cast<rows3*>(hist[0]);
+  lml::assign(older) = newer; // memmove
+  assert( hist[1][0] == 0 && hist[3][7] == 23 );
+
+  double dh[5]{0,1,2,3,4};
+  auto& dlo = *reinterpret_cast<double(*)[4]>(dh);
+  auto& dhi = *reinterpret_cast<double(*)[4]>(dh + 1);
+  lml::assign(dhi) = dlo; // small_copy
+  assert( dh[1] == 0 && dh[4] == 3 );
+
+  return true;
+}
+
+bool test_assign_memset()
+{
+  int scratch[1024];
+  for (int& i : scratch) i = -1;
+  lml::assign(scratch) = {};
+  for (int i : scratch) assert( i == 0 );
+
+  double d[4][4]{{-1.}};
+  lml::assign(d) = {};
+  assert( d[0][0] == 0. && ! std::signbit(d[0][0]) );
+
+  void* p[3]{&d, &d, &d};
+  lml::assign(p) = {};
+  assert( p[0] == nullptr && p[2] == nullptr );
+
+  zero_pod z[2]{{1,2.f},{3,4.f}};
+  lml::assign(z) = {};
+  assert( z[0].i == 0 && z[1].f == 0.f );
+
+  // = {} clears in place, no value-initialized temporary array
+  static int big[1 << 22]{1};
+  lml::assign(big) = {};
+  assert( big[0] == 0 );
+
+  struct moved {
+    bool by_move = false;
+    moved& operator=(moved const&) { by_move = false; return *this; }
+    moved& operator=(moved&&) { by_move = true; return *this; }
+  };
+  moved m[2][2];
+  lml::assign(m) = {};
+  assert( m[0][0].by_move && m[1][1].by_move );
+  lml::assign(m) = {{}};
+  assert( ! m[0][0].by_move );
+
+  int i22[2][2]{{1,2},{3,4}};
+  lml::assign(i22) = {{5}};
+  assert( i22[0][0] == 5 && i22[0][1] == 0 && i22[1][1] == 0 );
+
+  return true;
+}
+
+bool test_assign_nontemporal()
+{
+  static unsigned char src[4099], dst[4099];
+  for (int i = 0; i != 4099; ++i)
+    src[i] = static_cast<unsigned char>(i * 7);
+
+  lml::assign(dst, lml::nontemporal) = src;
+  assert( lml::equal_to{}(dst, src) );
+  lml::assign(dst, lml::nontemporal) = {};
+  for (auto c : dst) assert( c == 0 );
+
+  // all head alignments and tail lengths of the streamed span
+  for (int off = 0; off != 16; ++off)
+    for (int n : {0, 1, 15, 16, 17, 63, 64, 65, 200})
+    {
+      for (auto& c : dst) c = 0xff;
+      lml::impl::stream_store(dst + off, src + 3, n);
+      for (int i = 0; i != 300; ++i)
+        assert( dst[i] == (i >= off && i < off + n ? src[i - off + 3]
+                                                   : 0xff) );
+      lml::impl::stream_store(dst + off, nullptr, n);
+      for (int i = 0; i != 300; ++i)
+        assert( dst[i] == (i >= off && i < off + n ? 0 : 0xff) );
+    }
+
+  // overlapping source and target fall back to memmove
+  for (int i = 0; i != 256; ++i) dst[i] = static_cast<unsigned char>(i);
+  lml::impl::stream_store(dst + 1, dst, 255);
+  assert( dst[0] == 0 && dst[1] == 0 && dst[255] == 254 );
+
+  float t[3][5]{{1,2,3,4,5}}, u[3][5];
+  lml::assign(u, lml::nontemporal) = t;
+  assert( u[0][4] == 5.f && u[2][4] == 0.f );
+  lml::assign(u[1], lml::nontemporal) = {6,7,8,9,10};
+  assert( u[1][0] == 6.f && u[1][4] == 10.f );
+
+  return true;
+}
+
+bool test_assign_convert()
+{
+  short s[37];
+  for (int i = 0; i != 37; ++i) s[i] = static_cast<short>(i * 1000 - 18000);
+  int w[37];
+  lml::assign(w) = s; // widening
+  assert( w[0] == -18000 && w[36] == 18000 );
+
+  double d[3][17];
+  for (int i = 0; i != 3*17; ++i) lml::flat_index(d, i) = i + 0.5;
+  float f[3][17];
+  lml::assign(f) = d; // narrowing float
+  assert( f[0][0] == 0.5f && f[2][16] == 50.5f );
+  int fi[3][17];
+  lml::assign(fi) = f; // float to int truncates
+  assert( fi[0][0] == 0 && fi[2][16] == 50 );
+  lml::assign(d) = fi; // int to double
+  assert( d[2][16] == 50. );
+
+  unsigned char u8[37];
+  lml::assign(u8) = s; // narrowing, modular
+  assert( u8[18] == static_cast<unsigned char>(s[18]) );
+
+  // overlapping source and target, by aliasing char, take the loop
+  unsigned char buf[8]{1,2,3,4,5,6,7,8};
+  auto& c4 = *reinterpret_cast<char(*)[4]>(buf + 2);
+  auto& u4 = *reinterpret_cast<unsigned char(*)[4]>(buf);
+  lml::assign(c4) = u4; // backward
+  assert( buf[2] == 1 && buf[3] == 2 && buf[4] == 3 && buf[5] == 4 );
+  lml::assign(u4) = c4; // forward
+  assert( buf[0] == 1 && buf[1] == 2 && buf[2] == 3 && buf[3] == 4 );
+
+  return true;
+}
+
+bool test_assign_saturate()
+{
+  int i[40];
+  for (int k = 0; k != 40; ++k) i[k] = (k - 20) * 20;
+  unsigned char u[40];
+  lml::assign_saturate(u) = i;
+  assert( u[0] == 0 && u[20] == 0 && u[21] == 20 && u[39] == 255 );
+  signed char c[40];
+  lml::assign_saturate(c) = i;
+  assert( c[0] == -128 && c[19] == -20 && c[39] == 127 );
+
+  unsigned ui[2][2]{{0u, 1u},{0x80000000u, 0xffffffffu}};
+  int si[2][2];
+  lml::assign_saturate(si) = ui;
+  assert( si[0][1] == 1 && si[1][0] == 0x7fffffff && si[1][1] == 0x7fffffff );
+  lml::assign_saturate(ui) = si;
+  assert( ui[1][1] == 0x7fffffffu );
+
+  long long ll[3]{-(1LL << 40), 5, 1LL << 40};
+  short sh[3];
+  lml::assign_saturate(sh) = ll;
+  assert( sh[0] == -32768 && sh[1] == 5 && sh[2] == 32767 );
+
+  return true;
+}
+
+bool test_fill()
+{
+  int a[64][64];
+  lml::fill(a, 7);
+  assert( a[0][0] == 7 && a[63][63] == 7 && a[31][17] == 7 );
+  lml::assign(a).fill(-1); // memset 0xff
+  assert( a[0][0] == -1 && a[63][63] == -1 );
+  lml::assign(a[3]).fill(0x01010101); // memset 0x01
+  assert( a[3][63] == 0x01010101 && a[4][0] == -1 );
+
+  char s[3][5];
+  assert( &lml::fill(s, 'x') == &s );
+  assert( s[0][0] == 'x' && s[2][4] == 'x' );
+
+  double d[2][3][5];
+  lml::fill(d, 0.5);
+  assert( d[0][0][0] == 0.5 && d[1][2][4] == 0.5 );
+  lml::fill(d, 1); // converted
+  assert( d[1][2][4] == 1. );
+
+  struct rgb { unsigned char r, g, b; };
+  rgb px[33];
+  lml::fill(px, rgb{1,2,3});
+  assert( px[0].g == 2 && px[32].b == 3 );
+
+  // trivially copyable, with a converting operator= that depends on the
+  // old value, so it must be assigned to each element, not copied
+  struct acc {
+    int x;
+    acc& operator=(int v) { x += v; return *this; }
+    acc& operator=(acc const&) = default;
+  };
+  acc ac[3]{{1},{2},{3}};
+  lml::fill(ac, 10);
+  assert( ac[0].x == 11 && ac[1].x == 12 && ac[2].x == 13 );
+
+  std::string strs[2][2];
+  lml::fill(strs, "abc"); // element loop, converting assignment
+  assert( strs[1][1] == "abc" );
+
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  using int0 = int[0];
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  int0&& z = {};
+  lml::fill(z, 1);
+
+  return true;
+}
+
+constexpr bool test_fill_constexpr()
+{
+  int a[2][3]{};
+  lml::assign(a).fill(4);
+  lml::fill(a[1], 5);
+  return a[0][2] == 4 && a[1][0] == 5 && a[1][2] == 5;
+}
+static_assert( test_fill_constexpr() );
+
+template <typename A, typename V>
+concept fillable = requires (A& a, V const& v) { lml::fill(a, v); };
+static_assert(   fillable<int[2][2], long> );
+static_assert( ! fillable<int const[2], int> );
+static_assert( ! fillable<int*[2], int> );
+static_assert( ! fillable<int, int> );
+
+bool test_assign_block()
+{
+  static float img[512][512];
+  for (int i = 0; i != 512*512; ++i)
+    lml::flat_index(img, i) = float(i);
+
+  float tile[8][8];
+  lml::assign_block<8,8>(tile, img, 100, 200);
+  assert( tile[0][0] == img[100][200] && tile[7][7] == img[107][207] );
+  assert( tile[3][5] == img[103][205] );
+
+  lml::assign_block<8,8>(img, {300,7}, tile, {0,0}); // tile write back
+  assert( img[300][7] == tile[0][0] && img[307][14] == tile[7][7] );
+
+  assert(  (lml::block_in_bounds<8,8>(img, {504,504})) );
+  assert( ! (lml::block_in_bounds<8,8>(img, {505,0})) );
+  assert( ! (lml::block_in_bounds<8,8>(img, {0,~0ul})) );
+
+  int vol[4][5][6]{}, sub[2][3][4];
+  for (int i = 0; i != 4*5*6; ++i) lml::flat_index(vol, i) = i;
+  lml::assign_block<2,3,4>(sub, {0,0,0}, vol, {1,2,2});
+  assert( sub[0][0][0] == vol[1][2][2] && sub[1][2][3] == vol[2][4][5] );
+
+  int i = 1, r = 2, c = 1;              // int indices, as documented
+  int out[3][3][4]{};
+  lml::assign_block<2,3,4>(out, {i,0,0}, vol, {0,r,c});
+  assert( out[1][0][0] == vol[0][2][1] && out[2][2][3] == vol[1][4][4] );
+  assert( (lml::block_in_bounds<2,3,4>(out, {i,0,0})) );
+  assert( ! (lml::block_in_bounds<2,3,4>(out, {-1,0,0})) );
+
+  double dt[2][3]; // converting element copy
+  lml::assign_block<2,3>(dt, sub[1], 0, 1);
+  assert( dt[0][0] == sub[1][0][1] && dt[1][2] == sub[1][1][3] );
+
+  std::string names[3][3]{{"a","b","c"},{"d","e","f"},{"g","h","i"}};
+  std::string corner[2][2];
+  lml::assign_block<2,2>(corner, names, 1, 1);
+  assert( corner[0][0] == "e" && corner[1][1] == "i" );
+
+  return true;
+}
+
+constexpr bool test_assign_block_constexpr()
+{
+  int a[3][4]{{0,1,2,3},{4,5,6,7},{8,9,10,11}}, b[2][2]{};
+  lml::assign_block<2,2>(b, a, 1, 2);
+  return b[0][0] == 6 && b[1][1] == 11;
+}
+static_assert( test_assign_block_constexpr() );
+
+template <decltype(sizeof 0) R, decltype(sizeof 0) C, typename D, typename S>
+concept blockable = requires (D& d, S const& s) {
+  lml::assign_block<R,C>(d, s, 0, 0);
+};
+static_assert(   blockable<8,8, float[8][8], float[512][512]> );
+static_assert( ! blockable<9,8, float[8][8], float[512][512]> );
+static_assert( ! blockable<8,8, float[8][8], float[512]> );
+static_assert( ! blockable<2,2, int const[2][2], int[2][2]> );
+
+template <typename T, int M, int N, typename U = T>
+bool test_transpose()
+{
+  static T src[M][N];
+  static U dst[N][M];
+  for (int i = 0; i != M; ++i)
+    for (int j = 0; j != N; ++j)
+      src[i][j] = static_cast<T>(i * 1000 + j);
+  assert( &lml::assign_transposed(dst, src) == &dst );
+  for (int i = 0; i != M; ++i)
+    for (int j = 0; j != N; ++j)
+      assert( dst[j][i] == static_cast<U>(src[i][j]) );
+  return true;
+}
+
+constexpr bool test_transpose_constexpr()
+{
+  int a[2][3]{{0,1,2},{3,4,5}}, t[3][2]{};
+  lml::assign_transposed(t, a);
+  return t[0][1] == 3 && t[2][0] == 2 && t[2][1] == 5;
+}
+static_assert( test_transpose_constexpr() );
+
+template <typename D, typename S>
+concept transposable = requires (D& d, S const& s) {
+  lml::assign_transposed(d, s);
+};
+static_assert(   transposable<int[3][2], int[2][3]> );
+static_assert(   transposable<double[3][2], int[2][3]> );
+static_assert( ! transposable<int[2][3], int[2][3]> );
+static_assert( ! transposable<int[6], int[6]> );
+static_assert( ! transposable<int const[3][2], int[2][3]> );
+
+bool test_swap_arrays()
+{
+  static double a[128][128], b[128][128];
+  for (int i = 0; i != 128*128; ++i) {
+    lml::flat_index(a, i) = i;
+    lml::flat_index(b, i) = -i;
+  }
+  lml::swap_arrays(a, b);
+  assert( a[0][1] == -1. && b[0][1] == 1. && a[127][127] == -(128*128-1) );
+
+  char c[67], d[67];
+  for (int i = 0; i != 67; ++i) { c[i] = 'c'; d[i] = 'd'; }
+  lml::swap_arrays(c, d); // 64 byte chunk, 1 byte tail
+  assert( c[0] == 'd' && c[66] == 'd' && d[63] == 'c' && d[64] == 'c' );
+
+  std::string s[2][2]{{"a","b"},{"c","d"}}, t[2][2]{{"w","x"},{"y","z"}};
+  lml::swap_arrays(s, t);
+  assert( s[1][1] == "z" && t[0][0] == "a" );
+
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  using int0 = int[0];
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  int0&& z0 = {}, &&z1 = {};
+  lml::swap_arrays(z0, z1);
+
+  return true;
+}
+
+constexpr bool test_swap_arrays_constexpr()
+{
+  int a[2][2]{{1,2},{3,4}}, b[2][2]{{5,6},{7,8}};
+  lml::swap_arrays(a, b);
+  return a[0][0] == 5 && a[1][1] == 8 && b[0][1] == 2;
+}
+static_assert( test_swap_arrays_constexpr() );
+
+template <typename A, typename B>
+concept array_swappable = requires (A& a, B& b) { lml::swap_arrays(a, b); };
+static_assert(   array_swappable<int[2][3], int[2][3]> );
+static_assert( ! array_swappable<int[2][3], int[3][2]> );
+static_assert( ! array_swappable<int[2], long[2]> );
+static_assert( ! array_swappable<int const[2], int[2]> );
+
+constexpr bool test_assign_nontemporal_constexpr()
+{
+  int a[2]{1,2}, b[2]{};
+  lml::assign(b, lml::nontemporal) = a;
+  bool ok = b[0] == 1 && b[1] == 2;
+  lml::assign(b, lml::nontemporal) = {};
+  return ok && b[0] == 0 && b[1] == 0;
+}
+static_assert( test_assign_nontemporal_constexpr() );
+
 bool test_assign_elements()
 {
   int a[3][2], b[3][2];
@@ -103,6 +539,35 @@ int main()
   test_assign_array1D();
   test_assign_array2D();
   test_assign_elements();
+  test_assign_memmove();
+  test_small_copy(std::make_index_sequence<65>{});
+  test_assign_overlap();
+  test_assign_memset();
+  test_assign_nontemporal();
+  test_assign_convert();
+  test_assign_saturate();
+  test_fill();
+  test_assign_block();
+  test_swap_arrays();
+
+  test_transpose<float,1,1>();
+  test_transpose<float,4,4>();
+  test_transpose<float,17,33>();
+  test_transpose<int,300,517>();
+  test_transpose<unsigned,512,512>();
+  test_transpose<double,3,2>();
+  test_transpose<double,129,65>();
+  test_transpose<long long,256,64>();
+  test_transpose<short,70,90>();
+  test_transpose<int,40,24,double>();
+
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  using int0x5 = int[0][5];
+  using int5x0 = int[5][0];
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  int0x5&& z05 = {};
+  int5x0 z50;
+  lml::assign_transposed(z50, z05);
 
   wrap<int> wi{2};
   auto& [wiv] = wi;
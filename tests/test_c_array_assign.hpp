@@ -130,3 +130,74 @@ namespace lml {
 
   static_assert(   ASSIGNABLE_TO_LVAL(int2,int2,&&) );
 }
+
+using lml::impl::memmove_assignable_from;
+
+static_assert(   memmove_assignable_from<float(&)[4][4], float(&)[4][4]> );
+static_assert(   memmove_assignable_from<int(&)[2], int const(&)[2]> );
+static_assert(   memmove_assignable_from<int(&)[2], int(&&)[2]> );
+static_assert( ! memmove_assignable_from<int(&)[2], long(&)[2]> );
+static_assert( ! memmove_assignable_from<int volatile(&)[2], int(&)[2]> );
+static_assert( ! memmove_assignable_from<int(&)[2], int volatile(&)[2]> );
+
+struct zero_pod { int i; float f; };
+template <> inline constexpr bool
+lml::is_value_init_zero_bits_v<zero_pod> = true;
+
+enum class zero_enum { zero };
+struct one_pod { int i = 1; };
+
+static_assert(   lml::is_value_init_zero_bits_v<int> );
+static_assert(   lml::is_value_init_zero_bits_v<zero_enum[4]> );
+static_assert(   lml::is_value_init_zero_bits_v<void*> );
+static_assert(   lml::is_value_init_zero_bits_v<std::nullptr_t> );
+static_assert(   lml::is_value_init_zero_bits_v<double[2][2]> );
+static_assert(   lml::is_value_init_zero_bits_v<zero_pod[3]> );
+static_assert( ! lml::is_value_init_zero_bits_v<int volatile> );
+static_assert( ! lml::is_value_init_zero_bits_v<int zero_pod::*> );
+static_assert( ! lml::is_value_init_zero_bits_v<one_pod[2]> );
+static_assert(   lml::is_value_init_zero_bits<int>() );
+
+using lml::impl::memset_clearable;
+
+static_assert(   memset_clearable<int(&)[8]> );
+static_assert(   memset_clearable<zero_pod(&)[2][2]> );
+static_assert( ! memset_clearable<int const(&)[8]> );
+static_assert( ! memset_clearable<one_pod(&)[2]> );
+
+using lml::impl::convert_assignable_from;
+
+static_assert(   convert_assignable_from<int(&)[4], short(&)[4]> );
+static_assert(   convert_assignable_from<float(&)[2][2],
+                                        double const(&)[2][2]> );
+static_assert( ! convert_assignable_from<int(&)[4], int(&)[4]> );
+static_assert( ! convert_assignable_from<int(&)[4], short(&)[2][2]> );
+static_assert( ! convert_assignable_from<int const(&)[4], short(&)[4]> );
+static_assert( ! convert_assignable_from<int(&)[4], zero_enum(&)[4]> );
+
+static_assert( lml::saturate_cast<unsigned char>(-1) == 0 );
+static_assert( lml::saturate_cast<unsigned char>(256) == 255 );
+static_assert( lml::saturate_cast<short>(-1LL << 40) == -32768 );
+static_assert( lml::saturate_cast<int>(0xffffffffu) == 0x7fffffff );
+static_assert( lml::saturate_cast<unsigned>(-5) == 0u );
+static_assert( lml::saturate_cast<long>(7u) == 7L );
+
+constexpr bool test_assign_saturate_constexpr()
+{
+  int i[3]{-1, 100, 1000};
+  unsigned char u[3]{};
+  lml::assign_saturate(u) = i;
+  float f[3]{};
+  lml::assign(f) = i;
+  return u[0] == 0 && u[1] == 100 && u[2] == 255 && f[2] == 1000.f;
+}
+static_assert( test_assign_saturate_constexpr() );
+
+template <typename L, typename R>
+concept saturate_assignable = requires (L& l, R const& r) {
+  lml::assign_saturate(l) = r;
+};
+static_assert(   saturate_assignable<short[2], long[2]> );
+static_assert( ! saturate_assignable<short[2], double[2]> );
+static_assert( ! saturate_assignable<short[2], long[3]> );
+static_assert( ! saturate_assignable<short const[2], long[2]> );
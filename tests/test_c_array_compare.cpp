@@ -1,8 +1,342 @@
 #include "test_c_array_compare.hpp"
 
 #include <cassert>
+#include <limits>
+#include <utility>
+
+bool test_equal_to_memcmp()
+{
+  unsigned char u8a[4096]{}, u8b[4096]{};
+  assert( lml::equal_to{}(u8a, u8b) );
+  u8b[4095] = 1;
+  assert( ! lml::equal_to{}(u8a, u8b) );
+  assert( lml::not_equal_to{}(u8a, u8b) );
+
+  int i2a[64][64]{}, i2b[64][64]{};
+  assert( lml::equal_to{}(i2a, i2b) );
+  i2a[63][0] = -1;
+  assert( ! lml::equal_to{}(i2a, i2b) );
+  assert( ! lml::equal_to{}(i2b, i2a) );
+  i2b[63][0] = -1;
+  assert( lml::equal_to{}(i2a, i2b) );
+
+  assert( lml::equal_to{}(i2a[0], {}) );
+  assert( ! lml::equal_to{}(i2a[63], {}) );
+
+  int x, y;
+  int* p2a[2]{&x,&y}, *p2b[2]{&x,&x};
+  assert( ! lml::equal_to{}(p2a, p2b) );
+  p2b[1] = &y;
+  assert( lml::equal_to{}(p2a, p2b) );
+
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  using int0 = int[0];
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  int0&& z0 = {}, &&z1 = {};
+  assert( lml::equal_to{}(z0, z1) );
+
+  return true;
+}
+
+// Check the ordering of arrays that first differ at each flat index i
+// against the per-element ordering of the first mismatched elements
+//
+template <typename E, int N, int M = 1>
+bool test_compare_three_way_mismatch(E lo, E hi)
+{
+  E a[M][N]{}, b[M][N]{};
+  for (int i = 0; i != M*N; ++i)
+  {
+    lml::flat_index(a,i) = lo;
+    lml::flat_index(b,i) = hi;
+    assert( lml::compare_three_way{}(a, b) < 0 );
+    assert( lml::compare_three_way{}(b, a) > 0 );
+    assert( lml::less{}(a, b) && ! lml::less{}(b, a) );
+    lml::flat_index(b,i) = lo;
+    assert( lml::compare_three_way{}(a, b) == 0 );
+    assert( ! lml::less{}(a, b) && ! lml::less{}(b, a) );
+  }
+  return true;
+}
+
+bool test_compare_floating()
+{
+  float nan = std::numeric_limits<float>::quiet_NaN();
+  float a[8][32]{}, b[8][32]{};
+  for (int i = 0; i != 8*32; ++i)
+  {
+    lml::flat_index(a,i) = -0.f;
+    assert( lml::equal_to{}(a, b) );
+    assert( lml::compare_three_way{}(a, b) == 0 );
+
+    lml::flat_index(a,i) = nan;
+    assert( ! lml::equal_to{}(a, b) );
+    assert( lml::compare_three_way{}(a, b)
+                == std::partial_ordering::unordered );
+    assert( ! lml::less{}(a, b) && ! lml::less{}(b, a) );
+
+    lml::flat_index(b,i) = -1.f;
+    assert( lml::compare_three_way{}(b, a)
+                == std::partial_ordering::unordered );
+    lml::flat_index(a,i) = lml::flat_index(b,i) = 0.f;
+  }
+
+  double d[3]{0.,nan,1.}, e[3]{0.,nan,0.};
+  assert( lml::compare_three_way{}(d, e)
+              == std::partial_ordering::unordered );
+  d[1] = e[1] = -0.;
+  assert( lml::compare_three_way{}(d, e) > 0 );
+  assert( lml::less{}(e, d) );
+  e[1] = 0.;
+  assert( lml::compare_three_way{}(d, e) > 0 );
+
+  return true;
+}
+
+struct eq_member {
+  int v;
+  bool operator==(eq_member const&) const = default;
+};
+
+bool test_mismatch()
+{
+  int i2a[64][64]{}, i2b[64][64]{};
+  assert( lml::mismatch(i2a, i2b) == 64*64 );
+  i2b[40][3] = 1;
+  assert( lml::mismatch(i2a, i2b) == 40*64 + 3 );
+  i2a[1][0] = 1;
+  assert( lml::mismatch(i2a, i2b) == 64 );
+
+  long la[3]{1,2,3};
+  assert( lml::mismatch(la, {1,2,4}) == 2 );
+  assert( lml::mismatch(la, {1,2,3}) == 3 );
+
+  double da[2][2]{{1.,-0.},{2.,3.}}, db[2][2]{{1.,0.},{2.,4.}};
+  assert( lml::mismatch(da, db) == 3 );
+  db[0][0] = std::numeric_limits<double>::quiet_NaN();
+  assert( lml::mismatch(db, db) == 0 );
+
+  eq_member ea[3]{{1},{2},{3}}, eb[3]{{1},{2},{4}};
+  assert( lml::mismatch(ea, eb) == 2 );
+
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  using int0 = int[0];
+  using double0 = double[0];
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  int0&& z0 = {}, &&z1 = {};
+  assert( lml::mismatch(z0, z1) == 0 );
+  double0&& d0 = {};
+  assert( lml::mismatch(d0, d0) == 0 );
+
+  return true;
+}
+
+// Check find_row, count_rows and match_rows against a per-row loop
+// for a table of R rows of N elements of type E
+//
+template <typename E, int R, int N>
+bool test_rows()
+{
+  E table[R][N]{}, key[N]{};
+  for (int i = 0; i != R; ++i)
+    for (int j = 0; j != N; ++j)
+      table[i][j] = static_cast<E>(i % 5 == 3 ? j : i * N + j);
+  for (int j = 0; j != N; ++j)
+    key[j] = static_cast<E>(j);
+
+  decltype(sizeof 0) first = R, count = 0;
+  for (auto i = first; i-- != 0;)
+    if (lml::equal_to{}(table[i], key))
+      first = i, ++count;
+
+  assert( lml::find_row(table, key) == first );
+  assert( lml::count_rows(table, key) == count );
+  auto mask = lml::match_rows(table, key);
+  assert( mask.count() == count );
+  for (int i = 0; i != R; ++i)
+    assert( mask.test(i) == lml::equal_to{}(table[i], key) );
+
+  key[0] = static_cast<E>(-1);
+  assert( lml::find_row(table, key) == R );
+  assert( lml::count_rows(table, key) == 0 );
+
+  key[0] = static_cast<E>(0);                  // last element differs
+  key[N-1] = static_cast<E>(-1);
+  count = 0;
+  for (int i = 0; i != R; ++i)
+    count += lml::equal_to{}(table[i], key);
+  assert( lml::count_rows(table, key) == count );
+  assert( lml::match_rows(table, key).count() == count );
+  return true;
+}
+
+constexpr unsigned char k67[67]{1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17};
+constexpr double kd[3]{0.,1.,2.};
+
+bool test_equals()
+{
+  char get[5] = "GET ", put[5] = "PUT ";
+  assert( lml::equals<"GET ">(get) && ! lml::equals<"GET ">(put) );
+  get[4] = '!';
+  assert( ! lml::equals<"GET ">(get) );
+
+  int i22[2][2]{{0,1},{2,3}};
+  assert( lml::equals<a01_23>(i22) );
+  i22[1][1] = 4;
+  assert( ! lml::equals<a01_23>(i22) );
+
+  // all byte offsets of a 17-byte constant, odd sized words
+  unsigned char u17[17]{1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17};
+  constexpr unsigned char k17[17]{1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17};
+  for (int i = 0; i != 17; ++i)
+  {
+    assert( lml::equals<k17>(u17) );
+    u17[i] ^= 0x80;
+    assert( ! lml::equals<k17>(u17) );
+    u17[i] ^= 0x80;
+  }
+
+  unsigned char u67[67]{1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17};
+  assert( lml::equals<k67>(u67) );
+  u67[66] = 1;
+  assert( ! lml::equals<k67>(u67) );
+
+  double d[3]{-0.,1.,2.};
+  assert( lml::equals<kd>(d) );
+
+  return true;
+}
+
+// Check small_equal<S> for all sizes up to 64 bytes and all byte offsets
+template <decltype(sizeof 0)... S>
+void test_small_equal(std::index_sequence<S...>)
+{
+  unsigned char a[64], b[64];
+  for (int i = 0; i != 64; ++i)
+    a[i] = b[i] = static_cast<unsigned char>(i * 37);
+  auto check = [&]<decltype(sizeof 0) N>() {
+    assert( lml::impl::small_equal<N>(a, b) );
+    for (decltype(sizeof 0) i = 0; i != N; ++i)
+    {
+      b[i] ^= 0x10;
+      assert( ! lml::impl::small_equal<N>(a, b) );
+      b[i] ^= 0x10;
+    }
+    b[N % 64] ^= 1; // beyond N bytes, not compared
+    assert( N == 64 || lml::impl::small_equal<N>(a, b) );
+    b[N % 64] ^= 1;
+  };
+  (check.template operator()<S>(), ...);
+}
+
+// Check small_mismatch<S> and small_byte_compare<S> for all sizes up to
+// 64 bytes and all byte offsets, with a later differing byte too
+template <decltype(sizeof 0)... S>
+void test_small_mismatch(std::index_sequence<S...>)
+{
+  unsigned char a[64], b[64];
+  for (int i = 0; i != 64; ++i)
+    a[i] = b[i] = static_cast<unsigned char>(i * 37);
+  auto check = [&]<decltype(sizeof 0) N>() {
+    assert( lml::impl::small_mismatch<N>(a, b) == N );
+    assert( lml::impl::small_byte_compare<N>(a, b) == 0 );
+    for (decltype(sizeof 0) i = 0; i != N; ++i)
+    {
+      b[i] ^= 0x10;
+      b[N - 1] ^= 0x01;
+      assert( lml::impl::small_mismatch<N>(a, b) == i );
+      assert( (lml::impl::small_byte_compare<N>(a, b) < 0)
+           == (a[i] < b[i]) );
+      b[N - 1] ^= 0x01;
+      b[i] ^= 0x10;
+    }
+  };
+  (check.template operator()<S>(), ...);
+}
+
+void test_bitwise()
+{
+  double z[3]{0.,1.,2.}, nz[3]{-0.,1.,2.};
+  assert( lml::equal_to{}(z, nz) && ! lml::bitwise_equal_to{}(z, nz) );
+  assert( lml::bitwise_compare{}(z, nz) < 0 ); // sign bit in top byte
+
+  double n[2]{std::numeric_limits<double>::quiet_NaN(), 1.};
+  assert( ! lml::equal_to{}(n, n) && lml::bitwise_equal_to{}(n, n) );
+
+  rgb s0[64]{}, s1[64]{};
+  assert( lml::bitwise_equal_to{}(s0, s1) );
+  s1[63].b = 1;
+  assert( ! lml::bitwise_equal_to{}(s0, s1) );
+  assert( lml::bitwise_compare{}(s0, s1) == std::strong_ordering::less );
+
+  int i23[2][3]{{0,1,2},{3,4,5}}, i6[6]{0,1,2,3,4,5};
+  assert( lml::bitwise_equal_to{}(i23, i6) );
+}
 
 int main() {
+  test_equal_to_memcmp();
+
+  test_compare_three_way_mismatch<unsigned char,67>(1,2);
+  test_compare_three_way_mismatch<signed char,35,2>(-1,1);
+  test_compare_three_way_mismatch<short,9,5>(255,256);
+  test_compare_three_way_mismatch<int,64,3>(-1,0);
+  test_compare_three_way_mismatch<unsigned,17>(0xff,0x100);
+  test_compare_three_way_mismatch<long long,5,7>(-1LL<<40,1);
+  test_compare_three_way_mismatch<unsigned long long,33>(1ULL<<56,1ULL<<57);
+
+  test_compare_three_way_mismatch<char8_t,16>(u8'a',u8'\xff');
+  test_compare_three_way_mismatch<std::byte,8,2>(std::byte{0x7f},
+                                                 std::byte{0x80});
+  test_compare_three_way_mismatch<char,16>('\x01','\x7f');
+
+  unsigned char d0[16]{0x80}, d1[16]{0x7f,0xff};
+  assert( lml::compare_three_way{}(d0, d1) == std::strong_ordering::greater );
+  assert( lml::less{}(d1, d0) && ! lml::less{}(d0, d1) );
+
+  test_compare_three_way_mismatch<float,32,8>(1.f,2.f);
+  test_compare_three_way_mismatch<double,5,3>(-2.,-1.);
+  test_compare_floating();
+  test_mismatch();
+
+  test_rows<unsigned short,1024,8>();
+  test_rows<unsigned char,100,1>();
+  test_rows<unsigned char,100,2>();
+  test_rows<int,77,1>();
+  test_rows<int,77,2>();
+  test_rows<int,77,3>();
+  test_rows<long long,33,2>();
+  test_rows<long long,33,5>();
+  test_rows<double,20,4>();
+  test_rows<long long,33,6>();   // 48-byte rows
+  test_rows<int,41,16>();        // 64-byte rows
+  test_rows<unsigned char,37,64>();
+
+  test_equals();
+  test_bitwise();
+  test_small_equal(std::make_index_sequence<65>{});
+  test_small_mismatch(std::make_index_sequence<65>{});
+
+  char c16a[16] = "sixteen chars!!", c16b[16] = "sixteen chars!!";
+  int i33a[3][3]{{1,2,3},{4,5,6},{7,8,9}}, i33b[3][3]{{1,2,3},{4,5,6},{7,8,9}};
+  assert( lml::equal_to{}(c16a, c16b) && lml::equal_to{}(i33a, i33b) );
+  c16b[15] = '?';
+  i33b[2][2] = 0;
+  assert( ! lml::equal_to{}(c16a, c16b) && ! lml::equal_to{}(i33a, i33b) );
+  assert( lml::compare_three_way{}(c16a, c16b) < 0 && lml::less{}(c16a, c16b) );
+  assert( lml::compare_three_way{}(i33b, i33a) < 0 && lml::less{}(i33b, i33a) );
+  assert( lml::mismatch(c16a, c16b) == 15 && lml::mismatch(i33a, i33b) == 8 );
+  float f4a[4]{1,2,3,4}, f4b[4]{1,2,3.5f,0};
+  assert( lml::mismatch(f4a, f4b) == 2 && lml::less{}(f4a, f4b) );
+  assert( lml::compare_three_way{}(f4b, f4a) > 0 );
+  assert( lml::mismatch(f4a, f4a) == 4 );
+
+  unsigned short table[4][8]{{1},{2},{3},{2}};
+  assert( lml::find_row(table, {2}) == 1 );
+  assert( lml::count_rows(table, {2}) == 2 );
+
+  char hello[] = "hello", world[] = "world";
+  assert( lml::compare_three_way{}(hello, world) < 0 );
+  assert( lml::less{}(hello, world) );
 
 //assert( lml::compare_three_way{}(a,     A{1,0}) < 0);
   //std::cout << std::endl;
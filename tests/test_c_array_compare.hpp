@@ -131,3 +131,87 @@ int less_data[][3]{
 #include <algorithm>
 
 static_assert( std::ranges::is_sorted( less_data, lml::less{} ) );
+
+using lml::impl::bitwise_equality_comparable_with;
+
+enum class byte_enum : unsigned char {};
+struct eq_overloaded { int v; };
+enum eq_overloaded_enum { EOE };
+bool operator==(eq_overloaded_enum, eq_overloaded_enum);
+
+static_assert(   bitwise_equality_comparable_with<int[2][3],int[2][3]> );
+static_assert(   bitwise_equality_comparable_with<int const(&)[6],int[6]> );
+static_assert(   bitwise_equality_comparable_with<char const(&)[4],
+                                                  char(&&)[4]> );
+static_assert(   bitwise_equality_comparable_with<int*[2],int*[2]> );
+static_assert(   bitwise_equality_comparable_with<byte_enum[2],
+                                                  byte_enum[2]> );
+static_assert( ! bitwise_equality_comparable_with<int[2],long[2]> );
+static_assert( ! bitwise_equality_comparable_with<int[6],int[2][3]> );
+static_assert( ! bitwise_equality_comparable_with<double[2],double[2]> );
+static_assert( ! bitwise_equality_comparable_with<int volatile[2],int[2]> );
+static_assert( ! bitwise_equality_comparable_with<eq_overloaded[2],
+                                                  eq_overloaded[2]> );
+static_assert( ! bitwise_equality_comparable_with<eq_overloaded_enum[2],
+                                                  eq_overloaded_enum[2]> );
+
+using lml::impl::byte_lexicographic_comparable_with;
+
+static_assert(   byte_lexicographic_comparable_with<unsigned char[16],
+                                                    unsigned char[16]> );
+static_assert(   byte_lexicographic_comparable_with<char8_t const(&)[4],
+                                                    char8_t[4]> );
+static_assert(   byte_lexicographic_comparable_with<std::byte[2][8],
+                                                    std::byte[2][8]> );
+static_assert( ! byte_lexicographic_comparable_with<signed char[2],
+                                                    signed char[2]> );
+static_assert(   byte_lexicographic_comparable_with<char[2],char[2]>
+              == std::is_unsigned_v<char> );
+static_assert( ! byte_lexicographic_comparable_with<byte_enum[2],
+                                                    byte_enum[2]> );
+
+static_assert( lml::mismatch(a01_23, a01_22) == 3 );
+static_assert( lml::mismatch(a01_23, a01_23) == 4 );
+static_assert( lml::mismatch(a01_23, {{0,1},{2,3}}) == 4 );
+static_assert( lml::mismatch(a, b) == 2 );
+static_assert( lml::mismatch(I2{0,1}, L2{0,2}) == 1 );
+static_assert( lml::mismatch("hello", "help!") == 3 );
+static_assert( lml::mismatch(1, 2) == 0 && lml::mismatch(1, 1L) == 1 );
+
+constexpr int rows3x2[3][2] {{0,1},{2,3},{0,1}};
+static_assert( lml::find_row(rows3x2, {0,1}) == 0 );
+static_assert( lml::find_row(rows3x2, rows3x2[1]) == 1 );
+static_assert( lml::find_row(rows3x2, {1,1}) == 3 );
+static_assert( lml::count_rows(rows3x2, {0,1}) == 2 );
+static_assert( lml::match_rows(rows3x2, {0,1}).bits[0] == 0b101 );
+static_assert( lml::find_row(a01_23, L2{2,3}) == 1 );
+
+constexpr int k2x2[2][2] {{0,1},{2,3}};
+static_assert( lml::equals<k2x2>(a01_23) );
+static_assert( ! lml::equals<k2x2>(a01_22) );
+static_assert( lml::equals<"GET">("GET") );
+static_assert( ! lml::equals<"GET">("PUT") );
+static_assert( lml::equals<{{'G','E','T',' '}}>({'G','E','T',' '}) );
+static_assert( std::is_same_v<decltype(lml::c_array_constant{"GET"}.value),
+                              char[4]> );
+
+using lml::impl::bitwise_comparable_with;
+
+struct rgb { unsigned char r, g, b; };
+
+static_assert(   bitwise_comparable_with<double[4], double const(&)[4]> );
+static_assert(   bitwise_comparable_with<int[2][3], int[6]> );
+static_assert(   bitwise_comparable_with<rgb[2], rgb[2]> );
+static_assert( ! bitwise_comparable_with<int[2], long[2]> );
+static_assert( ! bitwise_comparable_with<int[2], int[3]> );
+static_assert( ! bitwise_comparable_with<int volatile[2], int[2]> );
+static_assert( ! bitwise_comparable_with<int, int> );
+
+static_assert( lml::bitwise_equal_to{}(a01_23, {{0,1},{2,3}}) );
+static_assert( ! lml::bitwise_equal_to{}(a01_23, a01_22) );
+static_assert( lml::bitwise_compare{}(a01_23, a01_22) > 0 );
+static_assert( lml::bitwise_compare{}("hello", "help!") < 0 );
+
+constexpr rgb rgb2[2] {{1,2,3},{4,5,6}};
+static_assert( lml::bitwise_equal_to{}(rgb2, {{1,2,3},{4,5,6}}) );
+static_assert( lml::bitwise_compare{}(rgb2, {{1,2,3},{4,5,7}}) < 0 );
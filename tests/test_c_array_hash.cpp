@@ -0,0 +1,113 @@
+#include "c_array_hash.hpp"
+
+#include <cassert>
+#include <limits>
+#include <unordered_set>
+
+static_assert( lml::impl::bytes_hashable<int[4]> );
+static_assert( lml::impl::bytes_hashable<char const(&)[16]> );
+static_assert( lml::impl::bytes_hashable<int*[2][2]> );
+static_assert( ! lml::impl::bytes_hashable<double[4]> );
+static_assert( ! lml::impl::bytes_hashable<int> );
+static_assert( lml::impl::element_hashable<double[4]> );
+static_assert( lml::impl::element_hashable<int> );
+
+struct no_hash {};
+static_assert( ! std::is_invocable_v<lml::hash, no_hash[2]> );
+static_assert( std::is_invocable_v<lml::hash, int const(&)[2][3]> );
+
+// A key class with an array member, hashed and compared as an array
+//
+struct digest
+{
+  unsigned char v[16];
+  bool operator==(digest const& r) const { return lml::equal_to{}(v,r.v); }
+};
+struct digest_hash
+{
+  auto operator()(digest const& d) const { return lml::hash{}(d.v); }
+};
+
+// Check all lengths, so all the tail reads of hash_bytes are covered,
+// that equal arrays hash equal and that one-byte changes change hash
+//
+bool test_hash_bytes()
+{
+  unsigned char a[128], b[128];
+  for (int i = 0; i != 128; ++i)
+    a[i] = b[i] = static_cast<unsigned char>(i * 7 + 1);
+
+  for (unsigned n = 0; n != 128; ++n)
+  {
+    auto h = lml::impl::hash_bytes(a, n);
+    assert( h == lml::impl::hash_bytes(b, n) );
+    for (unsigned i = 0; i != n; ++i)
+    {
+      b[i] ^= 0x10;
+      assert( h != lml::impl::hash_bytes(b, n) );
+      b[i] ^= 0x10;
+    }
+    if (n != 0)
+      assert( h != lml::impl::hash_bytes(a, n - 1) );
+  }
+  return true;
+}
+
+bool test_hash()
+{
+  int i4[4]{1,2,3,4}, j4[4]{1,2,3,4};
+  int const (&ci4)[4] = i4;
+  assert( lml::hash{}(i4) == lml::hash{}(j4) );
+  assert( lml::hash{}(i4) == lml::hash{}(ci4) );
+  assert( lml::hash{}(i4) == lml::hash{}((int(&&)[4])j4) );
+  assert( lml::hash{}(i4) == lml::hash{}({1,2,3,4}) );
+  assert( lml::hash{}(i4) != lml::hash{}({1,2,3,5}) );
+
+  int i22[2][2]{{1,2},{3,4}};
+  assert( lml::hash{}(i22) == lml::hash{}(i4) );
+
+  char const hello[] = "hello";
+  assert( lml::hash{}(hello) == lml::hash{}("hello") );
+  assert( lml::hash{}(hello) != lml::hash{}("hellp") );
+
+  double d[2][2]{{0.,1.},{2.,3.}}, e[2][2]{{-0.,1.},{2.,3.}};
+  assert( lml::equal_to{}(d, e) );
+  assert( lml::hash{}(d) == lml::hash{}(e) );
+  e[1][1] = 4.;
+  assert( lml::hash{}(d) != lml::hash{}(e) );
+
+  assert( lml::hash{}(42) == std::hash<int>{}(42) );
+
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  using int0 = int[0];
+  using double0 = double[0];
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  int0&& z0 = {}, &&z1 = {};
+  assert( lml::hash{}(z0) == lml::hash{}(z1) );
+  double0&& d0 = {};
+  (void)lml::hash{}(d0);
+
+  return true;
+}
+
+bool test_unordered_set()
+{
+  std::unordered_set<digest, digest_hash> set;
+  for (int i = 0; i != 1000; ++i)
+  {
+    digest d{};
+    d.v[i % 16] = static_cast<unsigned char>(i / 16 + 1);
+    set.insert(d);
+  }
+  assert( set.size() == 1000 );
+  assert( set.contains(digest{{0,1}}) );
+  assert( ! set.contains(digest{}) );
+  return true;
+}
+
+int main()
+{
+  test_hash_bytes();
+  test_hash();
+  test_unordered_set();
+}
@@ -0,0 +1,93 @@
+#include "c_array_map.hpp"
+
+#include <cassert>
+#include <string>
+
+using flow_map = lml::c_array_map<unsigned[4], int>;
+using symbol_map = lml::c_array_map<char[32], std::string>;
+
+static_assert( std::is_same_v<flow_map::key_type, unsigned[4]> );
+template <typename K>
+concept c_array_map_key = requires { typename lml::c_array_map<K,int>; };
+
+static_assert(   c_array_map_key<char[32]> );
+static_assert(   c_array_map_key<double[2][2]> );
+static_assert( ! c_array_map_key<int> );
+static_assert( ! c_array_map_key<int const[2]> );
+static_assert( ! c_array_map_key<std::string[2]> );
+
+bool test_flow_map()
+{
+  flow_map m;
+  assert( m.empty() && ! m.find({1,2,3,4}) && ! m.erase({1,2,3,4}) );
+
+  for (unsigned i = 0; i != 10000; ++i)
+  {
+    auto [v, inserted] = m.try_emplace({i, i*3, ~i, 80}, int(i));
+    assert( inserted && *v == int(i) );
+  }
+  assert( m.size() == 10000 );
+  assert( m.capacity() >= 10000 * 8 / 7 );
+
+  for (unsigned i = 0; i != 10000; ++i)
+  {
+    unsigned key[4]{i, i*3, ~i, 80};
+    int* v = m.find(key);
+    assert( v && *v == int(i) );
+    assert( ! m.contains({i, i*3, ~i, 81}) );
+    assert( ! m.try_emplace(key, -1).second );
+  }
+
+  for (unsigned i = 0; i != 10000; i += 2)
+    assert( m.erase({i, i*3, ~i, 80}) );
+  assert( m.size() == 5000 );
+
+  for (unsigned i = 0; i != 10000; ++i)
+    assert( m.contains({i, i*3, ~i, 80}) == (i % 2 == 1) );
+
+  // churn, reusing deleted slots, without unbounded growth
+  auto cap = m.capacity();
+  for (unsigned i = 0; i != 100000; ++i)
+  {
+    m[{i, 0, 0, 0}] = 1;
+    assert( m.erase({i, 0, 0, 0}) );
+  }
+  assert( m.size() == 5000 && m.capacity() == cap );
+
+  int sum = 0;
+  m.for_each([&](unsigned const(&k)[4], int& v) {
+    assert( k[3] == 80 && int(k[0]) == v );
+    sum += 1;
+  });
+  assert( sum == 5000 );
+
+  flow_map c = m;
+  assert( c.size() == 5000 && *c.find({1, 3, ~1u, 80}) == 1 );
+  m.clear();
+  assert( m.empty() && ! m.contains({1, 3, ~1u, 80}) );
+  m = std::move(c);
+  assert( m.size() == 5000 && c.empty() );
+
+  return true;
+}
+
+bool test_symbol_map()
+{
+  symbol_map m;
+  char hello[32] = "hello", lemur[32] = "lemur", hello_[32] = "hello!";
+  m[hello] = "world";
+  m[lemur] = "madagascar";
+  char key[32] = "hello";
+  assert( m.find(key) && *m.find(key) == "world" );
+  assert( ! m.find(hello_) );
+  assert( m.size() == 2 );
+  m.reserve(1000);
+  assert( m.capacity() >= 1000 && *m.find(lemur) == "madagascar" );
+  return true;
+}
+
+int main()
+{
+  test_flow_map();
+  test_symbol_map();
+}
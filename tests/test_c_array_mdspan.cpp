@@ -0,0 +1,78 @@
+#include "c_array_mdspan.hpp"
+
+#include <cassert>
+
+#if defined(__cpp_lib_mdspan)
+
+using size_t = decltype(sizeof 0);
+
+static_assert( std::is_same_v<lml::mdspan_extents_t<int[4][8][2]>,
+                              std::extents<size_t,4,8,2>> );
+static_assert( std::is_same_v<lml::mdspan_extents_t<int const(&)[3]>,
+                              std::extents<size_t,3>> );
+static_assert( std::is_same_v<lml::mdspan_extents_t<int>,
+                              std::extents<size_t>> );
+
+static_assert( std::is_same_v<lml::mdspan_t<int const(&)[2][3]>,
+              std::mdspan<int const, std::extents<size_t,2,3>>> );
+
+static_assert( std::is_same_v<lml::extents_c_array_t<int,
+                              std::extents<int,2,3>>, int[2][3]> );
+static_assert( std::is_same_v<lml::extents_c_array_t<int,
+                              std::extents<size_t>>, int> );
+
+template <typename X>
+concept static_c_array = requires { typename
+                         lml::extents_c_array_t<int, X>; };
+static_assert(   static_c_array<std::extents<size_t,2,3>> );
+static_assert( ! static_c_array<std::dextents<size_t,2>> );
+
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+using int02 = int[0][2];
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+
+static_assert( std::is_same_v<lml::mdspan_extents_t<int02>,
+                              std::extents<size_t,0,2>> );
+
+// Static extents, so the mdspan holds the data pointer only
+static_assert( sizeof(lml::mdspan_t<float[4][8][2]>) == sizeof(float*) );
+
+int main()
+{
+  float a[4][8][2];
+  for (int i = 0; i != 64; ++i)
+    lml::flat_index(a, i) = static_cast<float>(i);
+
+  auto m = lml::to_mdspan(a);
+  static_assert( decltype(m)::rank_dynamic() == 0 );
+  assert( m.size() == 64 && m.extent(1) == 8 );
+  assert(( &m[3,7,1] == &a[3][7][1] && &m[1,2,0] == &a[1][2][0] ));
+
+  float (&r)[4][8][2] = lml::from_mdspan(m);
+  assert( &r == &a );
+
+  int const c[2][3]{{1,2,3},{4,5,6}};
+  auto cm = lml::to_mdspan(c);
+  assert(( cm[1,2] == 6 ));
+  static_assert( std::is_same_v<decltype(lml::from_mdspan(cm)),
+                                int const(&)[2][3]> );
+
+  int x = 7;
+  auto xm = lml::to_mdspan(x);
+  assert( xm.rank() == 0 && xm[] == 7 && &lml::from_mdspan(xm) == &x );
+
+  int02&& z = {};
+  auto zm = lml::to_mdspan(z);
+  assert( zm.size() == 0 && zm.extent(1) == 2 && zm.empty() );
+  assert( &lml::from_mdspan(zm) == &z );
+}
+
+#else
+
+#if defined(LML_REQUIRE_MDSPAN)
+#error "<mdspan> required, LML_REQUIRE_MDSPAN, but not available"
+#endif
+
+int main() {} // <mdspan> not available
+
+#endif
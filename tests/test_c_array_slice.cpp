@@ -0,0 +1,162 @@
+#include "c_array_slice.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <string>
+
+using f4 = float[4][4];
+
+static_assert( std::ranges::forward_range<lml::slice_view<float,2>> );
+static_assert( std::ranges::sized_range<lml::slice_view<float,2>> );
+static_assert( std::ranges::view<lml::slice_view<float,2>> );
+static_assert( std::ranges::borrowed_range<lml::slice_view<float,2>> );
+
+static_assert( std::is_same_v<decltype(lml::slice(std::declval<f4&>())),
+                              lml::slice_view<float,2>> );
+static_assert( std::is_same_v<decltype(lml::slice(
+                              std::declval<f4 const&>())),
+                              lml::slice_view<float const,2>> );
+
+static_assert( std::is_convertible_v<lml::slice_view<int,2>,
+                                     lml::slice_view<int const,2>> );
+static_assert( ! std::is_convertible_v<lml::slice_view<int const,2>,
+                                       lml::slice_view<int,2>> );
+
+static_assert( std::equality_comparable<lml::slice_view<int,2>> );
+static_assert( std::equality_comparable_with<lml::slice_view<int,2>,
+                                             lml::slice_view<int const,2>> );
+static_assert( std::three_way_comparable<lml::slice_view<double,3>,
+                                         std::partial_ordering> );
+
+template <typename L, typename R>
+concept slice_assignable = requires (L l, R& r) { lml::assign(l) = r; };
+static_assert(   slice_assignable<lml::slice_view<int,2>, int[2][3]> );
+static_assert(   slice_assignable<lml::slice_view<long,2>, int[2][3]> );
+static_assert( ! slice_assignable<lml::slice_view<int,2>, int[6]> );
+static_assert( ! slice_assignable<lml::slice_view<int const,2>, int[2][3]> );
+
+constexpr bool test_constexpr()
+{
+  int a[8]{0,1,2,3,4,5,6,7}, b[8]{};
+  auto rev = lml::slice(a, 0, 7, 8, -1);
+  lml::assign(lml::slice(b)) = rev;
+  int n = 7;
+  for (int e : lml::slice(b))
+    if (e != n--)
+      return false;
+  lml::slice_view<int,2> m{a, {2,4}, {4,1}};   // a as int[2][4]
+  lml::slice_view<int,2> t{b, {2,4}, {1,2}};   // b transposed int[4][2]
+  lml::assign(t) = m;
+  return b[1] == 4 && b[6] == 3 && t == m && lml::slice(b) != rev
+      && m(1,2) == 6 && lml::slice(a) < lml::slice(b);
+}
+static_assert( test_constexpr() );
+
+constexpr int c8[8]{0,1,2,3,4,5,6,7};
+static_assert( lml::slice(c8, 0, 0, 4, 2) == lml::slice(c8, 0, 0, 4, 2) );
+static_assert( lml::slice(c8, 0, 0, 4, 2) != lml::slice(c8, 0, 1, 4, 2) );
+static_assert( lml::slice(c8, 0, 0, 4, 2) < lml::slice(c8, 0, 1, 4, 2) );
+static_assert( lml::slice_view<int const,2>{c8, {2,4}, {4,1}}(1,2) == 6 );
+static_assert( lml::slice_view<int const,2>{c8, {2,4}, {4,1}}
+            == lml::slice_view<int const,2>{c8, {2,4}, {4,1}} );
+
+void test_slice()
+{
+  int m[6][8];
+  for (int i = 0; i != 48; ++i)
+    lml::flat_index(m, i) = i;
+
+  auto all = lml::slice(m);
+  assert( all.size() == 48 && all.extent(0) == 6 && all.stride(0) == 8 );
+  assert( all(5,7) == 47 && &all(2,3) == &m[2][3] );
+  int n = 0;
+  for (int e : all)
+    assert( e == n++ );
+  assert( n == 48 );
+
+  auto col = lml::slice(m, 1, 3, 1);            // m[i][3]
+  assert( col.size() == 6 && col.extent(1) == 1 );
+  int c = 0;
+  for (int e : col)
+    assert( e == 3 + 8 * c++ );
+  assert( c == 6 );
+
+  auto odd = lml::slice(m, 0, 1, 3, 2);         // rows 1, 3, 5
+  assert( odd(0,0) == 8 && odd(2,7) == 47 && odd.size() == 24 );
+  assert( std::ranges::count_if(odd, [](int e){ return e/8 % 2 == 0; })
+          == 0 );
+
+  auto win = lml::slice(m, 0, 2, 3).slice(1, 2, 4);   // m[2:5][2:6]
+  int const expect[3][4]{{18,19,20,21},{26,27,28,29},{34,35,36,37}};
+  assert( lml::equal_to{}(win, lml::slice(expect)) );
+  assert( win == lml::slice(expect) );
+  assert( ! lml::less{}(win, lml::slice(expect)) );
+  assert( lml::compare_three_way{}(win, lml::slice(expect)) == 0 );
+  assert( win != col && std::ranges::equal(win, lml::slice(expect)) );
+
+  // reversed, by negative stride
+  auto rev = lml::slice(m[0], 0, 7, 8, -1);
+  assert( rev(0) == 7 && rev(7) == 0 );
+
+  // ordering, first differing element then extents
+  int const lo[2][2]{{1,2},{3,4}}, hi[2][2]{{1,2},{3,5}};
+  assert( lml::slice(lo) < lml::slice(hi) );
+  assert( lml::less{}(lml::slice(lo), lml::slice(hi)) );
+  assert( lml::compare_three_way{}(lml::slice(hi), lml::slice(lo)) > 0 );
+  assert( lml::slice(lo).slice(1,0,1) < lml::slice(lo) ); // extent 1 < 2
+
+  // assign a window in, and out, and a column clear and fill
+  int w[3][4]{};
+  lml::assign(lml::slice(w)) = win;
+  assert( lml::equal_to{}(w, expect) );
+
+  int z[6][8]{};
+  lml::assign(lml::slice(z, 0, 2, 3).slice(1, 2, 4)) = expect;
+  assert( z[2][2] == 18 && z[4][5] == 37 && z[1][2] == 0 && z[2][6] == 0 );
+  assert( lml::slice(z, 0, 2, 3).slice(1, 2, 4) == win );
+
+  lml::assign(col) = {};
+  assert( m[0][3] == 0 && m[5][3] == 0 && m[5][2] == 42 && m[5][4] == 44 );
+  lml::assign(col).fill(-1);
+  assert( m[0][3] == -1 && m[5][3] == -1 );
+
+  // strided row to unit row, converting
+  long l[1][4];
+  lml::assign(lml::slice(l)) = lml::slice(m, 0, 5, 1).slice(1, 0, 4, 2);
+  assert( l[0][0] == 40 && l[0][1] == 42 && l[0][2] == 44 && l[0][3] == 46 );
+
+  // non-trivial elements
+  std::string s[2][3]{{"a","b","c"},{"d","e","f"}}, t[2][1];
+  lml::assign(lml::slice(t)) = lml::slice(s, 1, 2, 1);
+  assert( t[0][0] == "c" && t[1][0] == "f" );
+  assert( lml::slice(t) == lml::slice(s, 1, 2, 1) );
+
+  // outer strides past the end are not added, m[5] is the last row
+  auto c7 = lml::slice(m, 1, 7, 1);
+  assert( std::ranges::distance(c7) == 6
+       && *std::ranges::next(c7.begin(), 5) == 47 );
+  int h[7]{0,1,2,3,4,5,6};
+  auto h3 = lml::slice(h, 0, 0, 3, 3);         // h[0], h[3], h[6]
+  int s3 = 0;
+  for (int e : h3)
+    s3 += e;
+  assert( h3.size() == 3 && h3(2) == 6 && s3 == 9 );
+
+  // empty views
+  auto e = lml::slice(m, 0, 0, 0);
+  assert( e.empty() && e.begin() == e.end() );
+  assert( e != lml::slice(m, 1, 0, 0) && e == lml::slice(z, 0, 3, 0) );
+  lml::assign(e) = {};
+
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  using int02 = int[0][2];
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  int02&& z0 = {};
+  auto s0 = lml::slice(z0);
+  assert( s0.empty() && s0.extent(1) == 2 && s0 == lml::slice(z0) );
+}
+
+int main()
+{
+  test_slice();
+}
@@ -29,5 +29,25 @@ int main()
  && lml::flat_index(mint4213,8) == 8
  && lml::flat_index(mint4213,23) == 3;
 
+    auto [i,j,k,l] = lml::unflatten<decltype(mint4213)>(23);
+    flat_index_test = flat_index_test &&
+    &lml::md_index(mint4213,i,j,k,l) == &mint4213[3][1][0][2]
+ && lml::flat_offset<decltype(mint4213)>(i,j,k,l) == 23
+ && &lml::md_index(mint4213,1,1) == &mint4213[1][1];
+
+    struct padded { int a[2][3]; } p{{{1,2,3},{4,5,6}}};
+    int(&pa)[2][3] = p.a;
+    flat_index_test = flat_index_test &&
+    lml::md_index(pa,1,2) == 6 && lml::flat_index(pa,5) == 6;
+
+    auto& r64 = lml::reshape_cast<int[6][4]>(mint4213);
+    auto& r24 = lml::reshape_cast<int[2][12]>(mint4213);
+    auto&& rf = lml::reshape_cast<int[24]>(
+                 static_cast<int(&&)[4][2][1][3]>(mint4213));
+    static_assert( std::is_same_v<decltype(rf), int(&&)[24]> );
+    flat_index_test = flat_index_test &&
+    &r64[0][0] == &mint4213[0][0][0][0] && r64[5][3] == 3
+ && r64[1][2] == 6 && r24[1][11] == 3 && r24[0][6] == 6 && rf[23] == 3;
+
  return ! flat_index_test;
 }
@@ -249,6 +249,11 @@ static_assert( lml::flat_index(cint4213,6) == 6 );
 static_assert( lml::flat_index(cint4213,8) == 8 );
 static_assert( lml::flat_index(cint4213,23) == 3 );
 
+enum flat_pos { pos_five = 5, pos_last = 23 }; // unscoped enum index
+static_assert( lml::flat_index(cint4213,pos_five) == 5 );
+static_assert( lml::flat_index(cint4213,pos_last) == 3 );
+static_assert( lml::unflatten<int[4][2][1][3]>(pos_last)[0] == 3 );
+
 static_assert( std::is_same_v<lml::all_extents_removed_t<int[2][3]>,
                                                   int> );
 
@@ -266,3 +271,73 @@ static_assert( std::is_same_v<lml::all_extents_removed_t<int(&&)[2][3]>,
 
 static_assert( std::is_same_v<lml::all_extents_removed_t<int const(&&)[2][3]>,
                                                   int const&&> );
+
+// md_index(a,i,j...), flat_offset<A>(i,j...), unflatten<A>(i) tests
+
+static_assert( lml::md_index(cint4213,3,1,0,2) == 3 );
+static_assert( lml::md_index(cint4213,1,0,0,1) == 7 );
+static_assert( &lml::md_index(cint4213,2,1) == &cint4213[2][1] );
+static_assert( &lml::md_index(cint23) == &cint23 );
+static_assert( lml::md_index(int23{{1,2,3},{4,5,6}},1,2) == 6 );
+
+static_assert( std::is_same_v< decltype(lml::md_index(cint23,1)),
+                               int const(&)[3]> );
+static_assert( std::is_same_v< decltype(lml::md_index(int23{},1,1)),
+                               int&&> );
+static_assert( std::is_same_v< lml::md_index_t<int(&&)[1][2][3],2>,
+                               int(&&)[3]> );
+
+static_assert( lml::flat_offset<int[4][2][1][3]>(3,1,0,2) == 23 );
+static_assert( lml::flat_offset<int[4][2][1][3]>(1,0,0,1) == 7 );
+static_assert( lml::flat_offset<int[4][2][1][3]>(2,1) == 15 );
+static_assert( lml::flat_offset<int[4][2][1][3]>() == 0 );
+
+static_assert( lml::unflatten<int[4][2][1][3]>(23)
+               == std::array<decltype(sizeof 0),4>{3,1,0,2} );
+static_assert( lml::unflatten<int const(&)[2][3]>(4)
+               == std::array<decltype(sizeof 0),2>{1,1} );
+static_assert( lml::unflatten<int[5]>(4)[0] == 4 );
+static_assert( lml::unflatten<int[5]>(4).size() == 1 );
+
+constexpr bool unflatten_inverts_flat_offset()
+{
+  for (int i = 0; i != lml::flat_size<int[4][2][1][3]>; ++i) {
+    auto [a,b,c,d] = lml::unflatten<int[4][2][1][3]>(i);
+    if (lml::flat_offset<int[4][2][1][3]>(a,b,c,d) != unsigned(i)
+     || &lml::md_index(cint4213,a,b,c,d) != &lml::flat_index(cint4213,i))
+      return false;
+  }
+  return true;
+}
+static_assert( unflatten_inverts_flat_offset() );
+
+static_assert( lml::unflatten<int012>(0)
+               == std::array<decltype(sizeof 0),3>{} );
+static_assert( lml::flat_offset<int012>(0,0,1) == 1 );
+
+// reshape_cast<S>(a) tests
+
+static_assert( std::is_same_v<lml::reshape_cast_t<int[6][4], int(&)[4][6]>,
+                              int(&)[6][4]> );
+static_assert( std::is_same_v<lml::reshape_cast_t<int[24],
+                                                  int const(&&)[2][3][4]>,
+                              int const(&&)[24]> );
+static_assert( std::is_same_v<lml::reshape_cast_t<int const[2][12],
+                                                  int(&)[4][6]>,
+                              int const(&)[2][12]> );
+static_assert( std::is_same_v<lml::reshape_cast_t<int01, int0&>, int01&> );
+static_assert( std::is_same_v<lml::reshape_cast_t<int012, int01&>, int012&> );
+
+template <typename S, typename A>
+concept reshapable = requires (A a) { lml::reshape_cast<S>((A)a); };
+static_assert(   reshapable<int[6][4], int(&)[4][6]> );
+static_assert( ! reshapable<int[5][4], int(&)[4][6]> );  // flat size
+static_assert( ! reshapable<long[6][4], int(&)[4][6]> ); // element type
+static_assert( ! reshapable<int(&)[6][4], int(&)[4][6]> ); // S reference
+static_assert( ! reshapable<int[24], int> );
+
+// constexpr for the same shape, i.e. for rank 1 from rank 1
+static_assert( &lml::reshape_cast<int[2]>(cint2) == &cint2 );
+static_assert( lml::reshape_cast<int const[2][3]>(cint23)[1][2] == 6 );
+static_assert( std::is_same_v<decltype(lml::reshape_cast<int[2]>(cint2)),
+                              int const(&)[2]> );
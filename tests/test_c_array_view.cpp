@@ -0,0 +1,80 @@
+#include "c_array_view.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+using int88 = int[8][8];
+using cint23 = int const[2][3];
+
+static_assert( std::ranges::contiguous_range<lml::flat_view<int88>> );
+static_assert( std::ranges::contiguous_range<lml::flat_view<int[4]>> );
+static_assert( std::ranges::sized_range<lml::flat_view<int88>> );
+static_assert( std::ranges::view<lml::flat_view<int88>> );
+static_assert( std::ranges::borrowed_range<lml::flat_view<int88>> );
+static_assert( std::contiguous_iterator<lml::flat_iterator<int88>> );
+
+static_assert( std::is_same_v<lml::flat_view<int[4]>::iterator, int*> );
+static_assert( std::is_same_v<
+               std::ranges::range_reference_t<lml::flat_view<cint23>>,
+               int const&> );
+static_assert( std::is_same_v<
+               std::ranges::range_value_t<lml::flat_view<cint23>>, int> );
+
+template <typename A>
+concept flat_viewable = requires (A&& a) { lml::flat_view((A&&)a); };
+static_assert(   flat_viewable<int(&)[2][3]> );
+static_assert(   flat_viewable<int const(&)[2][3]> );
+static_assert( ! flat_viewable<int(&&)[2][3]> );
+static_assert( ! flat_viewable<int> );
+
+static_assert( lml::flat_view<int88>::size() == 64 );
+
+constexpr bool test_constexpr()
+{
+  int a[2][2][3]{{{5,3,9},{1,0,7}},{{2,8,4},{6,11,10}}};
+  std::ranges::sort(lml::flat_view(a));
+  int i = 0;
+  for (int e : lml::flat_view(a))
+    if (e != i++)
+      return false;
+  auto v = lml::flat_view(a);
+  return a[1][1][2] == 11 && v[7] == 7 && *(v.end() - 1) == 11
+      && &v.back() == &a[1][1][2] && v.size() == 12
+      && std::ranges::find(v, 6) - v.begin() == 6;
+}
+static_assert( test_constexpr() );
+
+constexpr int cint3[3]{3,1,2};
+static_assert( std::ranges::max(lml::flat_view(cint3)) == 3 );
+
+int main()
+{
+  int a[8][8];
+  auto v = lml::flat_view(a);
+  std::iota(v.begin(), v.end(), 0);
+  assert( a[0][0] == 0 && a[3][5] == 29 && a[7][7] == 63 );
+  assert( v.data() == &a[0][0] );
+  assert( std::to_address(v.end()) == &a[7][7] + 1 );
+
+  for (int& e : lml::flat_view(a))
+    e *= 2;
+  assert( a[7][7] == 126 );
+
+  std::ranges::reverse(v);
+  assert( a[0][0] == 126 && a[7][7] == 0 );
+
+  cint23& c = {{1,2,3},{4,5,6}};
+  assert( std::accumulate(lml::flat_view(c).begin(),
+                          lml::flat_view(c).end(), 0) == 21 );
+
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  using int0 = int[0];
+  using int02 = int[0][2];
+#include "ALLOW_ZERO_SIZE_ARRAY.hpp"
+  int0&& z = {};
+  int02&& zz = {};
+  assert( lml::flat_view(z).empty() && lml::flat_view(zz).empty() );
+  assert( lml::flat_view(zz).begin() == lml::flat_view(zz).end() );
+  static_assert( lml::flat_view<int02>::size() == 0 );
+}